@@ -4,8 +4,12 @@
 #include <string_view>
 
 #include <takatori/util/either.h>
+#include <takatori/util/sequence_view.h>
 
 #include "conversion_info.h"
+#include "date.h"
+#include "time_of_day.h"
+#include "time_point.h"
 
 namespace takatori::datetime {
 
@@ -52,4 +56,45 @@ using conversion_result = util::either<std::string, T>;
  */
 [[nodiscard]] conversion_result<zone_offset_info> parse_zone_offset(std::string_view contents);
 
+/**
+ * @brief parses each of the given contents as a date.
+ * @details This stops at the first element which is not a valid date.
+ *      Please call parse_date() for such the element to retrieve the error message.
+ * @param contents the source contents
+ * @param results the destination of the parsed dates
+ * @return the number of successfully parsed leading elements,
+ *      which is equal to the smaller size of contents and results if all of them were successfully parsed
+ */
+[[nodiscard]] std::size_t parse_dates(
+        util::sequence_view<std::string_view const> contents,
+        util::sequence_view<date> results);
+
+/**
+ * @brief parses each of the given contents as a time of day.
+ * @details This stops at the first element which is not a valid time of day.
+ *      Please call parse_time() for such the element to retrieve the error message.
+ * @param contents the source contents
+ * @param results the destination of the parsed time of day
+ * @return the number of successfully parsed leading elements,
+ *      which is equal to the smaller size of contents and results if all of them were successfully parsed
+ */
+[[nodiscard]] std::size_t parse_times(
+        util::sequence_view<std::string_view const> contents,
+        util::sequence_view<time_of_day> results);
+
+/**
+ * @brief parses each of the given contents as a datetime, with or without zone offset.
+ * @details This stops at the first element which is not a valid datetime.
+ *      Please call parse_datetime() for such the element to retrieve the error message.
+ *      If the element has a zone offset, the resulting time point is adjusted to UTC by the offset,
+ *      or otherwise the result just represents the local date and time.
+ * @param contents the source contents
+ * @param results the destination of the parsed time points
+ * @return the number of successfully parsed leading elements,
+ *      which is equal to the smaller size of contents and results if all of them were successfully parsed
+ */
+[[nodiscard]] std::size_t parse_datetimes(
+        util::sequence_view<std::string_view const> contents,
+        util::sequence_view<time_point> results);
+
 } // namespace takatori::datetime
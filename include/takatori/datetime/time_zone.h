@@ -8,6 +8,10 @@
 #include <string_view>
 #include <utility>
 
+#include <takatori/util/sequence_view.h>
+
+#include "time_point.h"
+
 namespace takatori::datetime {
 
 class time_zone;
@@ -67,7 +71,30 @@ public:
      */
     [[nodiscard]] std::chrono::minutes offset() const noexcept;
 
-    // FIXME: DST info
+    /**
+     * @brief returns the offset from UTC at the given time point, including daylight saving time.
+     * @param at the time point in UTC
+     * @return the offset from UTC
+     */
+    [[nodiscard]] std::chrono::seconds offset_at(time_point at) const noexcept;
+
+    /**
+     * @brief converts the time point in UTC into the local time point of this time zone.
+     * @param at the time point in UTC
+     * @return the local time point
+     * @see offset_at()
+     */
+    [[nodiscard]] time_point to_local(time_point at) const noexcept;
+
+    /**
+     * @brief converts each time point in UTC into the local time point of this time zone.
+     * @details This is faster than calling to_local(time_point) for each element,
+     *      especially if the neighboring elements are in the same daylight saving period.
+     * @param source the source time points in UTC
+     * @param destination the destination of the local time points, must be at least as long as the source
+     * @throws std::invalid_argument if the destination is shorter than the source
+     */
+    void to_local(util::sequence_view<time_point const> source, util::sequence_view<time_point> destination) const;
 
     /**
      * @brief returns whether or not the two elements are equivalent.
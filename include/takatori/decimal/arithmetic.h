@@ -0,0 +1,208 @@
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <string_view>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <takatori/util/sequence_view.h>
+
+#include "triple.h"
+
+namespace takatori::decimal {
+
+/**
+ * @brief the max number of significant digits which the native arithmetic kernels can produce.
+ * @details The kernels in this header compute the result directly on the triple representation only if its
+ *      coefficient has up to this number of digits. Otherwise, try_* functions return empty, and the others
+ *      fall back to `::decimal::Decimal` (mpdecimal) arithmetic which rounds the result to this precision.
+ */
+inline constexpr std::int32_t max_precision = 38;
+
+/**
+ * @brief represents rounding mode of decimal kernels.
+ */
+enum class rounding_mode {
+    /// @brief rounds towards zero (truncates the discarded digits).
+    down,
+    /// @brief rounds to nearest, and ties away from zero.
+    half_up,
+    /// @brief rounds to nearest, and ties to even.
+    half_even,
+};
+
+/**
+ * @brief returns string representation of the value.
+ * @param value the target value
+ * @return the corresponded string representation
+ */
+constexpr inline std::string_view to_string_view(rounding_mode value) noexcept {
+    using namespace std::string_view_literals;
+    using kind = rounding_mode;
+    switch (value) {
+        case kind::down: return "down"sv;
+        case kind::half_up: return "half_up"sv;
+        case kind::half_even: return "half_even"sv;
+    }
+    std::abort();
+}
+
+/**
+ * @brief appends string representation of the given value.
+ * @param out the target output
+ * @param value the target value
+ * @return the output
+ */
+inline std::ostream& operator<<(std::ostream& out, rounding_mode value) {
+    return out << to_string_view(value);
+}
+
+/**
+ * @brief compares the numeric value of the two decimals.
+ * @details Unlike `operator==`, this ignores the representation differences, e.g. `1.0` is equivalent to `1.00`.
+ * @param left the first value
+ * @param right the second value
+ * @return < 0 if left < right
+ * @return = 0 if left = right
+ * @return > 0 if left > right
+ */
+[[nodiscard]] int compare(triple left, triple right) noexcept;
+
+/**
+ * @brief computes `left + right` only if the exact result fits in max_precision digits.
+ * @details The exponent of the result is the lesser of the operands' exponents.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the exact sum
+ * @return empty if the exact sum is not representable in max_precision digits
+ */
+[[nodiscard]] std::optional<triple> try_add(triple left, triple right) noexcept;
+
+/**
+ * @brief computes `left - right` only if the exact result fits in max_precision digits.
+ * @details The exponent of the result is the lesser of the operands' exponents.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the exact difference
+ * @return empty if the exact difference is not representable in max_precision digits
+ */
+[[nodiscard]] std::optional<triple> try_subtract(triple left, triple right) noexcept;
+
+/**
+ * @brief computes `left * right` only if the exact result fits in max_precision digits.
+ * @details The exponent of the result is the sum of the operands' exponents.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the exact product
+ * @return empty if the exact product is not representable in max_precision digits
+ */
+[[nodiscard]] std::optional<triple> try_multiply(triple left, triple right) noexcept;
+
+/**
+ * @brief computes `left + right`.
+ * @details This only uses mpdecimal if the exact result is not representable in max_precision digits.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the sum, may be rounded to max_precision digits
+ * @throws std::invalid_argument if the result is not representable in triple
+ */
+[[nodiscard]] triple add(triple left, triple right);
+
+/**
+ * @brief computes `left - right`.
+ * @details This only uses mpdecimal if the exact result is not representable in max_precision digits.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the difference, may be rounded to max_precision digits
+ * @throws std::invalid_argument if the result is not representable in triple
+ */
+[[nodiscard]] triple subtract(triple left, triple right);
+
+/**
+ * @brief computes `left * right`.
+ * @details This only uses mpdecimal if the exact result is not representable in max_precision digits.
+ * @param left the left operand
+ * @param right the right operand
+ * @return the product, may be rounded to max_precision digits
+ * @throws std::invalid_argument if the result is not representable in triple
+ */
+[[nodiscard]] triple multiply(triple left, triple right);
+
+/**
+ * @brief changes the exponent of the given value.
+ * @details If the exponent is increased, this discards the lower digits by using the given rounding mode.
+ * @param value the source value
+ * @param exponent the exponent of the result
+ * @param mode the rounding mode
+ * @return the rescaled value
+ * @return empty if the exponent is decreased, and the resulting coefficient exceeds max_precision digits
+ */
+[[nodiscard]] std::optional<triple> rescale(
+        triple value,
+        std::int32_t exponent,
+        rounding_mode mode = rounding_mode::half_even) noexcept;
+
+/**
+ * @brief rounds the given value to the number of digits after the decimal point.
+ * @details This never changes the values which have the less fractional digits.
+ * @param value the source value
+ * @param scale the max number of digits after the decimal point, may be negative
+ * @param mode the rounding mode
+ * @return the rounded value
+ */
+[[nodiscard]] triple round(
+        triple value,
+        std::int32_t scale,
+        rounding_mode mode = rounding_mode::half_even) noexcept;
+
+/**
+ * @brief computes the total of the given values.
+ * @details This accumulates the values natively while the intermediate result fits in max_precision digits.
+ * @param values the source values
+ * @return the total, or zero if the values are empty
+ * @throws std::invalid_argument if the result is not representable in triple
+ */
+[[nodiscard]] triple sum(util::sequence_view<triple const> values);
+
+/**
+ * @brief computes `left[i] + right[i]` for each element.
+ * @param left the left operands
+ * @param right the right operands
+ * @param results the destination, must have the same size of operands
+ * @throws std::invalid_argument if the operands and destination have different sizes
+ * @throws std::invalid_argument if the individual result is not representable in triple
+ */
+void add(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results);
+
+/**
+ * @brief computes `left[i] - right[i]` for each element.
+ * @param left the left operands
+ * @param right the right operands
+ * @param results the destination, must have the same size of operands
+ * @throws std::invalid_argument if the operands and destination have different sizes
+ * @throws std::invalid_argument if the individual result is not representable in triple
+ */
+void subtract(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results);
+
+/**
+ * @brief computes `left[i] * right[i]` for each element.
+ * @param left the left operands
+ * @param right the right operands
+ * @param results the destination, must have the same size of operands
+ * @throws std::invalid_argument if the operands and destination have different sizes
+ * @throws std::invalid_argument if the individual result is not representable in triple
+ */
+void multiply(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results);
+
+} // namespace takatori::decimal
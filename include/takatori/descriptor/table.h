@@ -0,0 +1,377 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+#include "descriptor_kind.h"
+#include "binding_info.h"
+#include "element.h"
+#include "reference.h"
+
+#include <takatori/util/assertion.h>
+#include <takatori/util/exception.h>
+#include <takatori/util/hash.h>
+#include <takatori/util/optional_ptr.h>
+
+namespace takatori::descriptor {
+
+template<descriptor_kind Kind>
+class table;
+
+/**
+ * @brief a light weight handle of descriptors, which is registered in a descriptor table.
+ * @details This only consists of a pointer to the owner table and an ID in the table,
+ *      and is trivially copyable unlike element, which holds a shared pointer of the entity.
+ *      The equivalence and hash code are computed only from the table and ID, because the owner table assigns the same
+ *      ID to the equivalent descriptors.
+ *      That is, each handle `u` and `v` from the same table satisfies `u == v <=> u.descriptor() == v.descriptor()`.
+ * @attention The handle is only available while the owner table is alive.
+ * @attention The handles from different tables are always different, even if their descriptors are equivalent.
+ * @tparam Kind the element kind
+ * @see table
+ */
+template<descriptor_kind Kind>
+class handle {
+public:
+    /// @brief the descriptor type.
+    using descriptor_type = element<Kind>;
+
+    /// @brief the entity type.
+    using entity_type = binding_info<Kind>;
+
+    /// @brief the owner table type.
+    using table_type = table<Kind>;
+
+    /// @brief the ID type.
+    using id_type = std::uint32_t;
+
+    /// @brief the light weight reference type.
+    using reference_type = class reference<descriptor_type>;
+
+    /// @brief the descriptor kind
+    static constexpr inline descriptor_kind tag = Kind;
+
+    /// @brief the ID of empty handles.
+    static constexpr id_type npos = std::numeric_limits<id_type>::max();
+
+    /**
+     * @brief creates a new instance which refers an empty descriptor.
+     */
+    constexpr handle() noexcept = default;
+
+    /**
+     * @brief creates a new instance.
+     * @param owner the owner table
+     * @param id the ID in the table
+     */
+    constexpr handle(table_type const& owner, id_type id) noexcept :
+        table_ { std::addressof(owner) },
+        id_ { id }
+    {}
+
+    /**
+     * @brief returns the owner table.
+     * @return the owner table
+     * @return empty if this handle is empty
+     */
+    [[nodiscard]] constexpr util::optional_ptr<table_type const> owner() const noexcept {
+        return util::optional_ptr { table_ };
+    }
+
+    /**
+     * @brief returns the ID in the owner table.
+     * @return the ID
+     * @return npos if this handle is empty
+     */
+    [[nodiscard]] constexpr id_type id() const noexcept {
+        return id_;
+    }
+
+    /**
+     * @brief returns whether or not this handle is empty.
+     * @return true if this is empty
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return table_ == nullptr;
+    }
+
+    /**
+     * @brief returns the descriptor which this handle refers.
+     * @return the descriptor
+     * @warning undefined behavior if this handle is empty
+     */
+    [[nodiscard]] descriptor_type const& descriptor() const noexcept {
+        return table_->get(id_);
+    }
+
+    /**
+     * @brief returns the descriptor entity.
+     * @return the descriptor entity
+     * @warning undefined behavior if this handle is empty
+     */
+    [[nodiscard]] entity_type& entity() const noexcept {
+        return descriptor().entity();
+    }
+
+    /**
+     * @brief returns the descriptor entity.
+     * @return the descriptor entity
+     * @return empty if this handle is empty
+     */
+    [[nodiscard]] util::optional_ptr<entity_type> optional_entity() const noexcept {
+        if (empty()) {
+            return {};
+        }
+        return descriptor().optional_entity();
+    }
+
+    /**
+     * @brief returns a light weight reference of the descriptor.
+     * @return a reference
+     */
+    [[nodiscard]] reference_type reference() const noexcept {
+        if (empty()) {
+            return {};
+        }
+        return descriptor().reference();
+    }
+
+private:
+    table_type const* table_ {};
+    id_type id_ { npos };
+};
+
+/**
+ * @brief returns whether or not the each element which the handle indicates is same.
+ * @tparam Kind the element kind
+ * @param a the first handle
+ * @param b the second handle
+ * @return true if the two handles are equivalent
+ * @return false otherwise
+ */
+template<descriptor_kind Kind>
+inline bool operator==(handle<Kind> const& a, handle<Kind> const& b) noexcept {
+    return a.id() == b.id() && a.owner().get() == b.owner().get();
+}
+
+/**
+ * @brief returns whether or not the each element which the handle indicates is not same.
+ * @tparam Kind the element kind
+ * @param a the first handle
+ * @param b the second handle
+ * @return true if the two handles are different
+ * @return false otherwise
+ */
+template<descriptor_kind Kind>
+inline bool operator!=(handle<Kind> const& a, handle<Kind> const& b) noexcept {
+    return !(a == b);
+}
+
+/**
+ * @brief appends string representation of the given value.
+ * @tparam Kind the element kind
+ * @param out the target output
+ * @param value the target value
+ * @return the output stream
+ */
+template<descriptor_kind Kind>
+inline std::ostream& operator<<(std::ostream& out, handle<Kind> const& value) {
+    return out << Kind << "(" << value.optional_entity() << ")";
+}
+
+/**
+ * @brief a table of descriptors, which assigns a dense ID for each distinct descriptor.
+ * @details This is designed to be shared in a scope of individual plans, and provides handle of the registered
+ *      descriptors. The registered descriptors are retained until the table is disposed.
+ *
+ *      This is thread-safe: add() is serialized by a mutex, and get() (or handle operations) never blocks
+ *      because the registered descriptors are never relocated.
+ * @tparam Kind the element kind
+ * @see handle
+ */
+template<descriptor_kind Kind>
+class table {
+public:
+    /// @brief the descriptor type.
+    using descriptor_type = element<Kind>;
+
+    /// @brief the entity type.
+    using entity_type = binding_info<Kind>;
+
+    /// @brief the handle type.
+    using handle_type = handle<Kind>;
+
+    /// @brief the ID type.
+    using id_type = typename handle_type::id_type;
+
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /// @brief the descriptor kind
+    static constexpr inline descriptor_kind tag = Kind;
+
+    /**
+     * @brief creates a new empty table.
+     */
+    table() = default;
+
+    /**
+     * @brief disposes this table and the all registered descriptors.
+     */
+    ~table() {
+        for (auto&& segment : segments_) {
+            delete segment.load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+    table(table const& other) = delete;
+    table& operator=(table const& other) = delete;
+    table(table&& other) noexcept = delete;
+    table& operator=(table&& other) noexcept = delete;
+
+    /**
+     * @brief registers the given descriptor, and returns its handle.
+     * @details If an equivalent descriptor is already registered, this returns the handle of it.
+     * @param descriptor the descriptor to register
+     * @return the handle of the descriptor
+     * @return an empty handle if the descriptor does not have its entity
+     * @throws std::length_error if the table is full
+     */
+    handle_type add(descriptor_type const& descriptor) {
+        auto entity = descriptor.optional_entity();
+        if (!entity) {
+            return {};
+        }
+        std::lock_guard lock { mutex_ };
+        if (auto iter = ids_.find(entity.get()); iter != ids_.end()) {
+            return handle_type { *this, iter->second };
+        }
+        auto id = size_.load(std::memory_order_relaxed);
+        if (id >= handle_type::npos - first_segment_size) {
+            util::throw_exception(std::length_error("too many descriptors"));
+        }
+        auto [segment_index, offset] = locate(id);
+        auto* segment = segments_[segment_index].load(std::memory_order_relaxed); // NOLINT(*-constant-array-index)
+        if (segment == nullptr) {
+            auto created = std::make_unique<segment_type>();
+            created->reserve(first_segment_size << segment_index);
+            segment = created.release();
+            segments_[segment_index].store(segment, std::memory_order_release); // NOLINT(*-constant-array-index)
+        }
+        BOOST_ASSERT(segment->size() == offset); // NOLINT
+        (void) offset;
+        auto&& stored = segment->emplace_back(descriptor);
+        ids_.emplace(stored.optional_entity().get(), id);
+        size_.store(id + 1, std::memory_order_release);
+        return handle_type { *this, id };
+    }
+
+    /**
+     * @brief returns the registered descriptor.
+     * @param id the descriptor ID
+     * @return the corresponded descriptor
+     * @warning undefined behavior if there is no such the descriptor
+     */
+    [[nodiscard]] descriptor_type const& get(id_type id) const noexcept {
+        BOOST_ASSERT(id < size_.load(std::memory_order_acquire)); // NOLINT
+        auto [segment_index, offset] = locate(id);
+        auto const* segment = segments_[segment_index].load(std::memory_order_acquire); // NOLINT(*-constant-array-index)
+        return segment->data()[offset]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief returns the handle of the registered descriptor.
+     * @param descriptor the descriptor
+     * @return the handle of the descriptor
+     * @return an empty handle if the descriptor is not registered in this table
+     */
+    [[nodiscard]] handle_type find(descriptor_type const& descriptor) const {
+        auto entity = descriptor.optional_entity();
+        if (!entity) {
+            return {};
+        }
+        std::lock_guard lock { mutex_ };
+        if (auto iter = ids_.find(entity.get()); iter != ids_.end()) {
+            return handle_type { *this, iter->second };
+        }
+        return {};
+    }
+
+    /**
+     * @brief returns the number of registered descriptors.
+     * @return the number of descriptors
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+private:
+    using segment_type = std::vector<descriptor_type>;
+
+    /// @brief the number of entries in the first segment, and the following segments doubles its size.
+    static constexpr id_type first_segment_size = 64;
+
+    static constexpr std::size_t max_segments = 32;
+
+    struct entity_hash {
+        std::size_t operator()(entity_type const* entity) const noexcept {
+            return std::hash<entity_type> {}(*entity);
+        }
+    };
+
+    struct entity_equal {
+        bool operator()(entity_type const* a, entity_type const* b) const noexcept {
+            return *a == *b;
+        }
+    };
+
+    std::array<std::atomic<segment_type*>, max_segments> segments_ {};
+    std::atomic<id_type> size_ { 0 };
+    std::unordered_map<entity_type const*, id_type, entity_hash, entity_equal> ids_ {};
+    mutable std::mutex mutex_ {};
+
+    /**
+     * @brief returns the segment index and offset in the segment of the given ID.
+     * @details The segment `i` contains IDs in `[(2^i - 1) * F, (2^(i+1) - 1) * F)`, where `F` is the first
+     *      segment size.
+     */
+    static constexpr std::pair<std::size_t, std::size_t> locate(id_type id) noexcept {
+        std::uint64_t position = static_cast<std::uint64_t>(id) / first_segment_size + 1;
+        std::size_t index = 0;
+        while ((position >> (index + 1U)) != 0) {
+            ++index;
+        }
+        std::uint64_t segment_begin = ((std::uint64_t { 1 } << index) - 1) * first_segment_size;
+        return { index, static_cast<std::size_t>(id - segment_begin) };
+    }
+};
+
+} // namespace takatori::descriptor
+
+/**
+ * @brief std::hash specialization for takatori::descriptor::handle.
+ * @tparam Kind the element kind
+ */
+template<takatori::descriptor::descriptor_kind Kind>
+struct std::hash<takatori::descriptor::handle<Kind>> {
+    /**
+     * @brief compute hash of the given object.
+     * @param value the target object
+     * @return computed hash code
+     */
+    std::size_t operator()(takatori::descriptor::handle<Kind> const& value) const noexcept {
+        return ::takatori::util::hash(value.owner().get(), value.id());
+    }
+};
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include <takatori/util/infect_qualifier.h>
+#include <takatori/util/sequence_view.h>
+
+namespace takatori::graph {
+
+/**
+ * @brief a view of the adjacent vertices, which are owners of the opposite of the individual connected ports.
+ * @details This skips the disconnected ports, and never copies the ports.
+ * @tparam Port the port type, may be const
+ * @attention the view will be invalidated if the ports or their connections are changed
+ */
+template<class Port>
+class adjacent_view {
+public:
+    /// @brief the port type.
+    using port_type = Port;
+
+    /// @brief the port sequence type.
+    using port_sequence_type = util::sequence_view<port_type>;
+
+    /// @brief the value type.
+    using value_type = util::infect_const_t<Port, typename std::remove_const_t<Port>::node_type>;
+
+    /// @brief the reference type.
+    using reference = std::add_lvalue_reference_t<value_type>;
+
+    /// @brief the pointer type.
+    using pointer = std::add_pointer_t<value_type>;
+
+    /**
+     * @brief a forward iterator over the adjacent vertices.
+     */
+    class iterator {
+    public:
+        /// @brief the value type.
+        using value_type = typename adjacent_view::value_type;
+        /// @brief the difference type.
+        using difference_type = std::ptrdiff_t;
+        /// @brief the pointer type.
+        using pointer = typename adjacent_view::pointer;
+        /// @brief the reference type.
+        using reference = typename adjacent_view::reference;
+        /// @brief the iterator category tag.
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief creates a new instance.
+         * @param current the current port position
+         * @param last the end of ports
+         */
+        constexpr iterator(typename port_sequence_type::iterator current, typename port_sequence_type::iterator last) noexcept :
+            current_ { current },
+            last_ { last }
+        {
+            skip();
+        }
+
+        /**
+         * @brief returns the value reference where this iterator pointing.
+         * @return reference of the current value
+         */
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            return current_->opposite()->owner();
+        }
+
+        /**
+         * @brief returns pointer to the value where this iterator pointing.
+         * @return pointer to the current value
+         */
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            return std::addressof(operator*());
+        }
+
+        /**
+         * @brief increments this iterator position.
+         * @return this
+         */
+        constexpr iterator& operator++() noexcept {
+            ++current_;
+            skip();
+            return *this;
+        }
+
+        /**
+         * @brief increments this iterator position.
+         * @return the last position
+         */
+        constexpr iterator const operator++(int) noexcept { // NOLINT
+            iterator r { *this };
+            operator++();
+            return r;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points the same position.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point the same position
+         * @return false otherwise
+         */
+        friend constexpr bool operator==(iterator const& a, iterator const& b) noexcept {
+            return a.current_ == b.current_;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points different positions.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point different positions
+         * @return false otherwise
+         */
+        friend constexpr bool operator!=(iterator const& a, iterator const& b) noexcept {
+            return !(a == b);
+        }
+
+    private:
+        typename port_sequence_type::iterator current_;
+        typename port_sequence_type::iterator last_;
+
+        constexpr void skip() noexcept {
+            while (current_ != last_ && !current_->opposite()) {
+                ++current_;
+            }
+        }
+    };
+
+    /**
+     * @brief creates a new instance.
+     * @param ports the source ports
+     */
+    explicit constexpr adjacent_view(port_sequence_type ports) noexcept :
+        ports_ { ports }
+    {}
+
+    /**
+     * @brief returns the source ports.
+     * @return the source ports, including disconnected ones
+     */
+    [[nodiscard]] constexpr port_sequence_type const& ports() const noexcept {
+        return ports_;
+    }
+
+    /**
+     * @brief returns whether or not this view is empty.
+     * @return true if there are no connected ports
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return begin() == end();
+    }
+
+    /**
+     * @brief returns a forward iterator which points the beginning of this sequence.
+     * @return the iterator of beginning (inclusive)
+     */
+    [[nodiscard]] constexpr iterator begin() const noexcept {
+        return iterator { ports_.begin(), ports_.end() };
+    }
+
+    /**
+     * @brief returns a forward iterator which points the ending of this sequence.
+     * @return the iterator of ending (exclusive)
+     */
+    [[nodiscard]] constexpr iterator end() const noexcept {
+        return iterator { ports_.end(), ports_.end() };
+    }
+
+private:
+    port_sequence_type ports_;
+};
+
+} // namespace takatori::graph
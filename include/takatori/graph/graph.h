@@ -1,9 +1,8 @@
 #pragma once
 
-#include <functional>
 #include <type_traits>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "graph_element_traits.h"
 #include "graph_iterator.h"
@@ -17,6 +16,10 @@ namespace takatori::graph {
 
 /**
  * @brief represents a graph.
+ * @details Each element in the graph has a dense ordinal, which represents its position in the graph.
+ *      The ordinal is kept in the element itself via graph_element_traits, so that it can be obtained in `O(1)`.
+ *      The elements are iterated in order of their ordinals, that is, the insertion order of them.
+ *      Removing an element shifts the succeeding elements, and renumbers their ordinals.
  * @tparam T the graph element type
  */
 template<class T>
@@ -32,10 +35,7 @@ public:
     using entry_type = std::add_pointer_t<element_type>;
 
     /// @brief the entity type
-    using entity_type = std::unordered_set<
-            entry_type,
-            std::hash<entry_type>,
-            std::equal_to<>>;
+    using entity_type = std::vector<entry_type>;
 
     /// @brief the value type
     using value_type = element_type;
@@ -57,6 +57,9 @@ public:
     /// @brief the const iterator type
     using const_iterator = graph_iterator<typename entity_type::const_iterator>;
 
+    /// @brief the ordinal which represents the element is not in this graph.
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
     /**
      * @brief creates a new object.
      */
@@ -106,9 +109,25 @@ public:
      * @return true if there is such the element
      * @return false otherwise
      */
-    bool contains(const_reference element) const {
-        auto iter = vertices_.find(entry_key(element));
-        return iter != vertices_.end();
+    bool contains(const_reference element) const noexcept {
+        return ordinal(element) != npos;
+    }
+
+    /**
+     * @brief returns the ordinal of the given element in this graph.
+     * @details The ordinals are dense, that is, they are in `[0, size())`.
+     *      If an element is removed from this graph, the ordinals of the succeeding elements are decremented.
+     * @param element the target element
+     * @return the ordinal of the element
+     * @return npos if this graph does not contain the element
+     */
+    [[nodiscard]] size_type ordinal(const_reference element) const noexcept {
+        // the element may have a stale ordinal, if it is not a member of this graph
+        auto position = traits::ordinal(element);
+        if (position < vertices_.size() && vertices_[position] == std::addressof(element)) {
+            return position;
+        }
+        return npos;
     }
 
     /**
@@ -154,24 +173,29 @@ public:
      * @return end() if it is not found
      */
     [[nodiscard]] iterator find(const_reference element) {
-        auto iter = vertices_.find(entry_key(element));
-        return iterator(iter);
+        if (auto position = ordinal(element); position != npos) {
+            return iterator(vertices_.begin() + static_cast<difference_type>(position));
+        }
+        return end();
     }
 
     /// @copydoc find()
     [[nodiscard]] const_iterator find(const_reference element) const {
-        auto iter = vertices_.find(entry_key(element));
-        return const_iterator(iter);
+        if (auto position = ordinal(element); position != npos) {
+            return const_iterator(vertices_.cbegin() + static_cast<difference_type>(position));
+        }
+        return cend();
     }
 
     /**
      * @brief removes an element.
+     * @details This takes `O(N)` time to keep the insertion order of the rest elements.
      * @param element the target element
      * @return true if successfully removed
      * @return false otherwise (may be no such the element)
      */
     bool erase(const_reference element) {
-        if (auto iter = vertices_.find(entry_key(element)); iter != vertices_.end()) {
+        if (auto iter = find(element); iter != end()) {
             erase(const_iterator(iter));
             return true;
         }
@@ -180,14 +204,14 @@ public:
 
     /**
      * @brief removes an element on the given iterator.
+     * @details This takes `O(N)` time to keep the insertion order of the rest elements.
      * @param position the target element position
      * @return the next position of the erased element
      */
     iterator erase(const_iterator position) {
         auto iter = position.unwrap();
         delete_element(*iter);
-        auto next = vertices_.erase(iter);
-        return iterator(next);
+        return remove_entry(iter);
     }
 
     /**
@@ -248,7 +272,7 @@ public:
      * @return the released element
      */
     std::unique_ptr<value_type> release(const_reference element) noexcept {
-        if (auto iter = vertices_.find(entry_key(element)); iter != vertices_.end()) {
+        if (auto iter = find(element); iter != end()) {
             auto kv = release(const_iterator(iter));
             return std::get<0>(std::move(kv));
         }
@@ -257,6 +281,7 @@ public:
 
     /**
      * @brief removes an element on the given iterator.
+     * @details This takes `O(N)` time to keep the insertion order of the rest elements.
      * @param position the target position
      * @return a pair of the removed element, and the next position of the released element
      */
@@ -264,8 +289,8 @@ public:
         auto iter = position.unwrap();
         std::unique_ptr<value_type> result { *iter };
         unbless_element(result.get());
-        auto next = vertices_.erase(iter);
-        return std::make_pair(std::move(result), iterator { next });
+        auto next = remove_entry(iter);
+        return std::make_pair(std::move(result), next);
     }
 
     /**
@@ -273,11 +298,13 @@ public:
      * @param other the source graph
      */
     void merge(graph&& other) {
+        reserve(vertices_.size() + other.vertices_.size());
         for (auto* v : other.vertices_) {
+            traits::ordinal(*v, vertices_.size());
+            vertices_.emplace_back(v);
             bless_element(v);
         }
-        vertices_.merge(other.vertices_);
-        other.clear();
+        other.vertices_.clear();
     }
 
     /**
@@ -367,33 +394,41 @@ public:
     }
 
 private:
-    entity_type vertices_;
+    using difference_type = typename entity_type::difference_type;
+    using traits = graph_element_traits<element_type>;
 
-    [[nodiscard]] static constexpr entry_type entry_key(const_reference element) noexcept {
-        return const_cast<entry_type>(std::addressof(element));  // NOLINT
-    }
+    entity_type vertices_;
 
     reference bless_element(entry_type element) noexcept {
-        graph_element_traits<element_type>::join(*element, *this);
+        traits::join(*element, *this);
         return *element;
     }
 
     void unbless_element(entry_type element) noexcept {
         if (element != nullptr) {
-            graph_element_traits<element_type>::leave(*element);
+            traits::leave(*element);
         }
     }
 
     template<class U>
     U* insert_element(std::unique_ptr<U> element) {
-        auto [iter, success] = vertices_.emplace(element.get());
-        if (!success) {
+        if (contains(*element)) {
             util::throw_exception(std::logic_error("conflict element ID"));
         }
-        (void) iter;
+        vertices_.emplace_back(element.get());
+        traits::ordinal(*element, vertices_.size() - 1);
         return element.release();
     }
 
+    iterator remove_entry(typename entity_type::const_iterator position) {
+        auto index = static_cast<size_type>(position - vertices_.cbegin());
+        auto next = vertices_.erase(position);
+        for (auto i = index, n = vertices_.size(); i < n; ++i) {
+            traits::ordinal(*vertices_[i], i);
+        }
+        return iterator(next);
+    }
+
     template<class U, class... Args>
     [[nodiscard]] std::unique_ptr<U> create_element(Args&&... args) {
         return std::make_unique<U>(std::forward<Args>(args)...);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <takatori/util/detect.h>
 #include <takatori/util/optional_ptr.h>
 
@@ -19,6 +21,10 @@ using graph_element_on_join_t = decltype(std::declval<T&>().on_join(std::declval
 template<class T>
 using graph_element_on_leave_t = decltype(std::declval<T&>().on_leave());
 
+/// @private
+template<class T>
+using graph_element_get_ordinal_t = decltype(std::declval<T const&>().graph_ordinal());
+
 } // namespace impl
 
 /**
@@ -28,7 +34,8 @@ using graph_element_on_leave_t = decltype(std::declval<T&>().on_leave());
 template<class T>
 using is_graph_element = std::bool_constant<
         util::is_detected_v<impl::graph_element_on_join_t, T>
-        && util::is_detected_v<impl::graph_element_on_leave_t, T>>;
+        && util::is_detected_v<impl::graph_element_on_leave_t, T>
+        && util::is_detected_v<impl::graph_element_get_ordinal_t, T>>;
 
 /// @copydoc is_graph_element
 template<class T>
@@ -36,6 +43,8 @@ inline constexpr bool is_graph_element_v = is_graph_element<T>::value;
 
 /**
  * @brief traits of graph elements.
+ * @details The graph elements must make this a friend,
+ *      to allow only the owner graph to set their ordinals via `graph_ordinal(std::size_t)`.
  * @tparam T the graph element type.
  */
 template<class T>
@@ -70,6 +79,24 @@ struct graph_element_traits {
     static void leave(reference element) {
         element.on_leave();
     }
+
+    /**
+     * @brief returns the ordinal of the element in the current graph.
+     * @param element the target element
+     * @return the ordinal which was last set by ordinal(reference, std::size_t)
+     */
+    [[nodiscard]] static std::size_t ordinal(const_reference element) noexcept {
+        return element.graph_ordinal();
+    }
+
+    /**
+     * @brief sets the ordinal of the element in the current graph.
+     * @param element the target element
+     * @param ordinal the ordinal
+     */
+    static void ordinal(reference element, std::size_t ordinal) noexcept {
+        element.graph_ordinal(ordinal);
+    }
 };
 
 } // namespace takatori::graph
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <takatori/util/infect_qualifier.h>
+
+namespace takatori::graph {
+
+/**
+ * @brief enumerates elements in the graph in topological order, on demand.
+ * @details This visits elements in depth first order, and yields each element after all of its successors were
+ *      yielded.
+ *      The successors are provided by `Enumerator::operator()(element_type&, Callback&&)`,
+ *      which must invoke the callback for each successor element.
+ *
+ *      This never uses type erased callbacks, and only allocates the working area of depth first search,
+ *      whose size is bounded by the number of elements.
+ *      The visited elements are marked by their ordinals kept in themselves (see graph::ordinal()),
+ *      so that each visit only costs `O(1)` without hashing, except for the successors outside of the graph.
+ * @tparam Enumerator the successor enumerator type
+ * @tparam Graph the graph type, may be const
+ * @attention the graph must not be modified while sorting
+ * @see topological_sort()
+ */
+template<class Enumerator, class Graph>
+class topological_sorter {
+public:
+    /// @brief the enumerator type.
+    using enumerator_type = Enumerator;
+
+    /// @brief the graph type.
+    using graph_type = Graph;
+
+    /// @brief the element type.
+    using element_type = util::infect_const_t<Graph, typename Graph::element_type>;
+
+    /// @brief the reference type of elements.
+    using reference = std::add_lvalue_reference_t<element_type>;
+
+    /// @brief the pointer type of elements.
+    using pointer = std::add_pointer_t<element_type>;
+
+    /**
+     * @brief an input iterator over the sorted elements.
+     * @details This advances the owner sorter, so that the sorted sequence can be iterated only once.
+     */
+    class iterator {
+    public:
+        /// @brief the value type.
+        using value_type = element_type;
+        /// @brief the difference type.
+        using difference_type = std::ptrdiff_t;
+        /// @brief the pointer type.
+        using pointer = typename topological_sorter::pointer;
+        /// @brief the reference type.
+        using reference = typename topological_sorter::reference;
+        /// @brief the iterator category tag.
+        using iterator_category = std::input_iterator_tag;
+
+        /**
+         * @brief creates a new instance which represents the end of sequence.
+         */
+        constexpr iterator() noexcept = default;
+
+        /**
+         * @brief creates a new instance, and then advances the owner to the first element.
+         * @param owner the owner sorter
+         */
+        explicit iterator(topological_sorter& owner) :
+            owner_ { std::addressof(owner) },
+            current_ { owner.next() }
+        {}
+
+        /**
+         * @brief returns the value reference where this iterator pointing.
+         * @return reference of the current value
+         */
+        [[nodiscard]] reference operator*() const noexcept {
+            return *current_;
+        }
+
+        /**
+         * @brief returns pointer to the value where this iterator pointing.
+         * @return pointer to the current value
+         */
+        [[nodiscard]] pointer operator->() const noexcept {
+            return current_;
+        }
+
+        /**
+         * @brief increments this iterator position.
+         * @return this
+         */
+        iterator& operator++() {
+            current_ = owner_->next();
+            return *this;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points the same position.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point the same position
+         * @return false otherwise
+         */
+        friend bool operator==(iterator const& a, iterator const& b) noexcept {
+            return a.current_ == b.current_;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points different positions.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point different positions
+         * @return false otherwise
+         */
+        friend bool operator!=(iterator const& a, iterator const& b) noexcept {
+            return !(a == b);
+        }
+
+    private:
+        topological_sorter* owner_ {};
+        pointer current_ {};
+    };
+
+    /**
+     * @brief creates a new instance.
+     * @param g the target graph
+     * @param enumerator the successor enumerator
+     */
+    explicit topological_sorter(Graph& g, Enumerator enumerator = {}) :
+        graph_ { std::addressof(g) },
+        enumerator_ { std::move(enumerator) },
+        saw_(g.size()),
+        root_ { g.begin() }
+    {
+        dfs_stack_.reserve(g.size());
+    }
+
+    /**
+     * @brief returns the next element in topological order.
+     * @return pointer to the next element
+     * @return nullptr if there are no more elements
+     */
+    [[nodiscard]] pointer next() {
+        while (true) {
+            while (!dfs_stack_.empty()) {
+                auto&& top = dfs_stack_.back();
+                if (!top.visited) {
+                    if (!test_and_set(top.element_ptr)) {
+                        // keep the current entry index for memory layout changes
+                        auto current_index = dfs_stack_.size() - 1;
+                        // extract successors into top of the stack, only if the first time visit of this entry
+                        enumerator_(*top.element_ptr, [this](reference successor) {
+                            if (!test(std::addressof(successor))) {
+                                dfs_stack_.emplace_back(dfs_entry { std::addressof(successor) });
+                            }
+                        });
+                        // revisit current entry later
+                        dfs_stack_[current_index].visited = true;
+                    } else {
+                        // already visited via other paths
+                        dfs_stack_.pop_back();
+                    }
+                } else {
+                    // already sorted at the revisit, because all successors have been already visited
+                    pointer result = top.element_ptr;
+                    dfs_stack_.pop_back();
+                    return result;
+                }
+            }
+            if (!advance_root()) {
+                return nullptr;
+            }
+        }
+    }
+
+    /**
+     * @brief returns an iterator of the rest elements in topological order.
+     * @return the iterator of beginning (inclusive)
+     * @attention this advances this sorter
+     */
+    [[nodiscard]] iterator begin() {
+        return iterator { *this };
+    }
+
+    /**
+     * @brief returns an iterator which represents the end of elements.
+     * @return the iterator of ending (exclusive)
+     */
+    [[nodiscard]] iterator end() const noexcept {
+        return {};
+    }
+
+private:
+    struct dfs_entry {
+        pointer element_ptr {};
+        bool visited { false };
+    };
+
+    Graph* graph_;
+    Enumerator enumerator_;
+
+    std::vector<dfs_entry> dfs_stack_ {};
+
+    // visited elements in the graph, indexed by their ordinals
+    std::vector<bool> saw_;
+
+    // visited elements outside of the graph
+    std::unordered_set<
+            pointer,
+            std::hash<pointer>,
+            std::equal_to<>> saw_foreign_ {};
+
+    // the next root candidate, and its ordinal
+    decltype(std::declval<Graph&>().begin()) root_;
+    typename Graph::size_type root_index_ { 0 };
+
+    // NOTE: graph::ordinal() just validates the ordinal in the element
+    [[nodiscard]] bool test(pointer element) const {
+        if (auto ordinal = graph_->ordinal(*element); ordinal != Graph::npos) {
+            return saw_[ordinal];
+        }
+        return saw_foreign_.find(element) != saw_foreign_.end();
+    }
+
+    [[nodiscard]] bool test_and_set(pointer element) {
+        if (auto ordinal = graph_->ordinal(*element); ordinal != Graph::npos) {
+            bool result = saw_[ordinal];
+            saw_[ordinal] = true;
+            return result;
+        }
+        return !saw_foreign_.emplace(element).second;
+    }
+
+    [[nodiscard]] bool advance_root() {
+        for (auto end = graph_->end(); root_ != end;) {
+            auto&& element = *root_;
+            ++root_;
+            // do nothing if already visited
+            if (saw_[root_index_++]) {
+                continue;
+            }
+            dfs_stack_.emplace_back(dfs_entry { std::addressof(element) });
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief enumerates elements in the graph in topological order.
+ * @tparam Enumerator the successor enumerator type
+ * @tparam Graph the graph type, may be const
+ * @tparam Consumer the element consumer type
+ * @param g the target graph
+ * @param consumer the element consumer
+ * @see topological_sorter
+ */
+template<class Enumerator, class Graph, class Consumer>
+void topological_sort(Graph& g, Consumer&& consumer) {
+    topological_sorter<Enumerator, Graph> sorter { g };
+    while (auto element = sorter.next()) {
+        consumer(*element);
+    }
+}
+
+} // namespace takatori::graph
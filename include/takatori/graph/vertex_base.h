@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "port_direction.h"
@@ -13,6 +14,9 @@ namespace takatori::graph {
 template<class Vertex>
 class graph;
 
+template<class T>
+struct graph_element_traits;
+
 /**
  * @brief an abstract implementation of vertex of graph.
  * @tparam Vertex the actual vertex type
@@ -105,11 +109,29 @@ public:
         on_join(nullptr);
     }
 
+    /**
+     * @brief returns the ordinal of this vertex in the owner graph.
+     * @return the ordinal, which is only valid if this vertex is a member of the graph
+     * @see graph::ordinal()
+     */
+    [[nodiscard]] std::size_t graph_ordinal() const noexcept {
+        return graph_ordinal_;
+    }
+
 protected:
     /**
      * @brief creates a new instance.
      */
     vertex_base() = default;
+
+private:
+    std::size_t graph_ordinal_ { static_cast<std::size_t>(-1) };
+
+    void graph_ordinal(std::size_t ordinal) noexcept {
+        graph_ordinal_ = ordinal;
+    }
+
+    friend struct graph_element_traits<vertex_type>;
 };
 
 } // namespace takatori::graph
@@ -8,10 +8,14 @@
 
 #include <takatori/document/region.h>
 
+#include "symbol.h"
+
 namespace takatori::name {
 
 /**
  * @brief represents an identifier.
+ * @details The identifier may have an interned token (see symbol_table), which enables to compare and hash
+ *      identifiers without inspecting their tokens, and to copy them without allocating tokens.
  */
 class identifier {
 public:
@@ -40,6 +44,14 @@ public:
     identifier(StringViewLike const& token) : // NOLINT
         token_ { token }
     {}
+
+    /**
+     * @brief creates a new instance from the interned token.
+     * @param token the interned token
+     * @see symbol_table::intern()
+     */
+    explicit identifier(symbol token) noexcept;
+
     /**
      * @brief returns the token of this identifier.
      * @return the token
@@ -54,6 +66,13 @@ public:
      */
     identifier& token(token_type token) noexcept;
 
+    /**
+     * @brief returns the interned token of this identifier.
+     * @return the interned token
+     * @return empty if the token is not interned
+     */
+    [[nodiscard]] symbol interned_symbol() const noexcept;
+
     /**
      * @brief returns the document region of this element.
      * @return the document region
@@ -72,6 +91,7 @@ public:
 
 private:
     token_type token_ {};
+    symbol symbol_ {};
     document::region region_ {};
 };
 
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <cstddef>
+
+namespace takatori::name {
+
+class symbol_table;
+
+/// @cond IMPL_DEFS
+namespace details {
+
+/**
+ * @brief an entry of interned tokens.
+ */
+struct symbol_entry {
+    std::string token;
+    std::size_t hash;
+    std::size_t id;
+    symbol_table const* owner;
+};
+
+} // namespace details
+/// @endcond
+
+/**
+ * @brief a handle of token interned in symbol_table.
+ * @details This is a trivially copyable reference to the interned token, and two symbols from the same
+ *      symbol_table are equivalent only if they are identical.
+ * @attention the symbol is invalidated if the owner symbol_table is disposed
+ * @see symbol_table::intern()
+ */
+class symbol {
+public:
+    /**
+     * @brief creates an empty symbol.
+     */
+    constexpr symbol() noexcept = default;
+
+    /**
+     * @brief creates a new instance.
+     * @param entry the interned entry
+     * @attention this is designed for symbol_table, developers should not call this directly
+     */
+    explicit constexpr symbol(details::symbol_entry const* entry) noexcept :
+        entry_ { entry }
+    {}
+
+    /**
+     * @brief returns the interned token.
+     * @return the token
+     * @warning undefined behavior if this symbol is empty
+     */
+    [[nodiscard]] std::string const& token() const noexcept {
+        return entry_->token;
+    }
+
+    /**
+     * @brief returns the ID of this symbol.
+     * @details The ID is unique in the owner symbol_table, and is assigned in the interned order.
+     * @return the symbol ID
+     * @warning undefined behavior if this symbol is empty
+     */
+    [[nodiscard]] std::size_t id() const noexcept {
+        return entry_->id;
+    }
+
+    /**
+     * @brief returns the hash code of the token.
+     * @details This is equivalent to `std::hash<std::string_view>` of token(), but it is computed only once.
+     * @return the hash code
+     * @warning undefined behavior if this symbol is empty
+     */
+    [[nodiscard]] std::size_t hash() const noexcept {
+        return entry_->hash;
+    }
+
+    /**
+     * @brief returns the owner of this symbol.
+     * @return the owner table
+     * @return nullptr if this symbol is empty
+     */
+    [[nodiscard]] symbol_table const* owner() const noexcept {
+        if (entry_ == nullptr) {
+            return nullptr;
+        }
+        return entry_->owner;
+    }
+
+    /**
+     * @brief returns whether or not this symbol is empty.
+     * @return true if this symbol is empty
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return entry_ == nullptr;
+    }
+
+    /**
+     * @brief returns whether or not this symbol is not empty.
+     * @return true if this symbol is not empty
+     * @return false otherwise
+     */
+    [[nodiscard]] explicit constexpr operator bool() const noexcept {
+        return !empty();
+    }
+
+    /**
+     * @brief returns whether or not the two symbols are identical.
+     * @param a the first symbol
+     * @param b the second symbol
+     * @return true if they are identical
+     * @return false otherwise
+     */
+    friend constexpr bool operator==(symbol a, symbol b) noexcept {
+        return a.entry_ == b.entry_;
+    }
+
+    /**
+     * @brief returns whether or not the two symbols are different.
+     * @param a the first symbol
+     * @param b the second symbol
+     * @return true if they are different
+     * @return false otherwise
+     */
+    friend constexpr bool operator!=(symbol a, symbol b) noexcept {
+        return !(a == b);
+    }
+
+private:
+    details::symbol_entry const* entry_ {};
+};
+
+/**
+ * @brief prints information of the given element into the output stream.
+ * @param out the target output stream
+ * @param value the target element
+ * @return the written output stream
+ */
+inline std::ostream& operator<<(std::ostream& out, symbol value) {
+    if (!value) {
+        return out << "symbol()";
+    }
+    return out << "symbol(" << value.id() << ":" << value.token() << ")";
+}
+
+} // namespace takatori::name
+
+/**
+ * @brief std::hash specialization for takatori::name::symbol.
+ */
+template<>
+struct std::hash<takatori::name::symbol> {
+    /**
+     * @brief compute hash of the given object.
+     * @param v the target object
+     * @return computed hash code
+     */
+    std::size_t operator()(takatori::name::symbol v) const noexcept {
+        return v ? v.hash() : 0;
+    }
+};
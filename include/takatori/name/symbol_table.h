@@ -0,0 +1,90 @@
+#pragma once
+
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "symbol.h"
+#include "identifier.h"
+#include "name.h"
+
+namespace takatori::name {
+
+/**
+ * @brief a table of interned tokens.
+ * @details Interned identifiers and names can be compared and hashed without inspecting their tokens, and can be
+ *      copied without allocating the individual tokens.
+ *
+ *      This is thread-safe: the individual operations can be invoked concurrently.
+ * @attention the interned symbols, identifiers, and names refer the table, so that it must not be disposed while
+ *      they are in use
+ */
+class symbol_table {
+public:
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief creates a new empty table.
+     */
+    symbol_table() = default;
+
+    ~symbol_table() = default;
+
+    symbol_table(symbol_table const& other) = delete;
+    symbol_table& operator=(symbol_table const& other) = delete;
+    symbol_table(symbol_table&& other) noexcept = delete;
+    symbol_table& operator=(symbol_table&& other) noexcept = delete;
+
+    /**
+     * @brief interns the given token.
+     * @param token the token
+     * @return the corresponding symbol, which is identical for the equivalent tokens
+     */
+    [[nodiscard]] symbol intern(std::string_view token);
+
+    /**
+     * @brief returns an identifier which has the interned token of the given one.
+     * @param id the source identifier
+     * @return the interned identifier, which keeps the document region of the source
+     * @return the copy of the source if it is empty or already interned into this table
+     */
+    [[nodiscard]] identifier intern_identifier(identifier const& id);
+
+    /**
+     * @brief returns a name whose individual identifiers are interned.
+     * @param n the source name
+     * @return the interned name, which keeps the document region of the source
+     */
+    [[nodiscard]] name intern_name(name const& n);
+
+    /**
+     * @brief returns the symbol of the given token only if it has been already interned.
+     * @param token the token
+     * @return the corresponding symbol
+     * @return empty if it is not interned yet
+     */
+    [[nodiscard]] std::optional<symbol> find(std::string_view token) const;
+
+    /**
+     * @brief returns the number of interned tokens.
+     * @return the number of tokens
+     */
+    [[nodiscard]] size_type size() const;
+
+    /**
+     * @brief returns the process wide symbol table.
+     * @details The returned table is never disposed.
+     * @return the global symbol table
+     */
+    [[nodiscard]] static symbol_table& global();
+
+private:
+    mutable std::shared_mutex mutex_ {};
+    std::deque<details::symbol_entry> entries_ {};
+    std::unordered_map<std::string_view, details::symbol_entry const*> index_ {};
+};
+
+} // namespace takatori::name
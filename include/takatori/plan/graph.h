@@ -1,10 +1,18 @@
 #pragma once
 
 #include <functional>
+#include <iterator>
+#include <memory>
 
 #include <takatori/graph/graph.h>
+#include <takatori/graph/topological_sort.h>
+#include <takatori/util/downcast.h>
+#include <takatori/util/fingerprint.h>
+#include <takatori/util/infect_qualifier.h>
 
 #include "step.h"
+#include "process.h"
+#include "exchange.h"
 
 namespace takatori::plan {
 
@@ -19,6 +27,14 @@ using consumer_type = std::function<void(step&)>;
 /// @brief the consumer type for const objects.
 using const_consumer_type = std::function<void(step const&)>;
 
+/**
+ * @brief the executor type of merge_into().
+ * @details The executor must invoke the given task with each index in `[0, count)` exactly once,
+ *      possibly in parallel, and then return after all of them were finished.
+ *      The task never throws exceptions.
+ */
+using executor_type = std::function<void(std::size_t count, std::function<void(std::size_t)> const& task)>;
+
 /**
  * @brief merges expressions in the source graph into the destination.
  * @details this may create a copy of each step in source, but reorganize the connections between steps.
@@ -35,6 +51,43 @@ void merge_into(
         graph_type&& source,
         graph_type& destination);
 
+/**
+ * @brief merges expressions in the source graph into the destination, with copying operator graphs in parallel.
+ * @details This creates a copy of each step in source like merge_into(graph_type const&, graph_type&),
+ *      but the operator graphs of the individual processes are copied by the worker threads.
+ *      The connections between the copied steps are reorganized on the current thread after all copies were finished.
+ *      The worker threads also use the util::object_memory_resource() of the current thread.
+ *
+ *      This creates the worker threads on each call, and the number of threads is also limited by the total number
+ *      of operators, so that small graphs are copied on the current thread without creating any threads.
+ *      To reuse the existing threads, use merge_into(graph_type const&, graph_type&, executor_type const&) instead.
+ * @param source the source graph
+ * @param destination the destination graph
+ * @param concurrency the max number of threads to copy operator graphs, including the current thread,
+ *      or `0` to use the number of hardware threads
+ * @throws std::exception if an error was occurred while copying steps, the first one is re-thrown
+ * @attention the source graph must not be modified until this operation was finished
+ */
+void merge_into(
+        graph_type const& source,
+        graph_type& destination,
+        std::size_t concurrency);
+
+/**
+ * @brief merges expressions in the source graph into the destination, with copying operator graphs on the executor.
+ * @details This is same as merge_into(graph_type const&, graph_type&, std::size_t),
+ *      but the operator graph of each process is copied as a task of the given executor, like a thread pool.
+ * @param source the source graph
+ * @param destination the destination graph
+ * @param executor the executor which runs the copy tasks
+ * @throws std::exception if an error was occurred while copying steps, the first one is re-thrown
+ * @attention the source graph must not be modified until this operation was finished
+ */
+void merge_into(
+        graph_type const& source,
+        graph_type& destination,
+        executor_type const& executor);
+
 /**
  * @brief enumerates steps which have no upstreams.
  * @param g the target graph
@@ -113,4 +166,451 @@ void sort_from_downstream(graph_type& g, consumer_type const& consumer);
 /// @copydoc sort_from_downstream()
 void sort_from_downstream(graph_type const& g, const_consumer_type const& consumer);
 
+/**
+ * @brief a lazy view of the adjacent steps.
+ * @details The adjacent steps of process are exchanges, and the adjacent steps of exchange are processes.
+ *      This view provides them as the common type step, without copying them.
+ * @tparam T the step type, may be const
+ * @attention the view will be invalidated if the connections of the step are changed
+ */
+template<class T>
+class adjacent_view {
+public:
+    /// @brief the value type.
+    using value_type = T;
+
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /// @brief the reference type.
+    using reference = std::add_lvalue_reference_t<value_type>;
+
+    /// @brief the pointer type.
+    using pointer = std::add_pointer_t<value_type>;
+
+    /// @brief the view type of adjacent processes.
+    using process_list_view = step_list_view<util::infect_const_t<T, process>>;
+
+    /// @brief the view type of adjacent exchanges.
+    using exchange_list_view = step_list_view<util::infect_const_t<T, exchange>>;
+
+    /**
+     * @brief a forward iterator over the adjacent steps.
+     */
+    class iterator {
+    public:
+        /// @brief the value type.
+        using value_type = typename adjacent_view::value_type;
+        /// @brief the difference type.
+        using difference_type = std::ptrdiff_t;
+        /// @brief the pointer type.
+        using pointer = typename adjacent_view::pointer;
+        /// @brief the reference type.
+        using reference = typename adjacent_view::reference;
+        /// @brief the iterator category tag.
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief creates a new instance.
+         * @param process_current the current position of processes
+         * @param process_last the end of processes
+         * @param exchange_current the current position of exchanges
+         */
+        constexpr iterator(
+                typename process_list_view::iterator process_current,
+                typename process_list_view::iterator process_last,
+                typename exchange_list_view::iterator exchange_current) noexcept :
+            process_current_ { process_current },
+            process_last_ { process_last },
+            exchange_current_ { exchange_current }
+        {}
+
+        /**
+         * @brief returns the value reference where this iterator pointing.
+         * @return reference of the current value
+         */
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            if (process_current_ != process_last_) {
+                return *process_current_;
+            }
+            return *exchange_current_;
+        }
+
+        /**
+         * @brief returns pointer to the value where this iterator pointing.
+         * @return pointer to the current value
+         */
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            return std::addressof(operator*());
+        }
+
+        /**
+         * @brief increments this iterator position.
+         * @return this
+         */
+        constexpr iterator& operator++() noexcept {
+            if (process_current_ != process_last_) {
+                ++process_current_;
+            } else {
+                ++exchange_current_;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief increments this iterator position.
+         * @return the last position
+         */
+        constexpr iterator const operator++(int) noexcept { // NOLINT
+            iterator r { *this };
+            operator++();
+            return r;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points the same position.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point the same position
+         * @return false otherwise
+         */
+        friend constexpr bool operator==(iterator const& a, iterator const& b) noexcept {
+            return a.process_current_ == b.process_current_ && a.exchange_current_ == b.exchange_current_;
+        }
+
+        /**
+         * @brief returns whether or not the two iterator points different positions.
+         * @param a the first iterator
+         * @param b the second iterator
+         * @return true if the both point different positions
+         * @return false otherwise
+         */
+        friend constexpr bool operator!=(iterator const& a, iterator const& b) noexcept {
+            return !(a == b);
+        }
+
+    private:
+        typename process_list_view::iterator process_current_;
+        typename process_list_view::iterator process_last_;
+        typename exchange_list_view::iterator exchange_current_;
+    };
+
+    /**
+     * @brief creates a new instance which consists of processes.
+     * @param processes the adjacent processes
+     */
+    explicit constexpr adjacent_view(process_list_view processes) noexcept :
+        processes_ { processes },
+        exchanges_ { typename exchange_list_view::cursor_type {}, typename exchange_list_view::cursor_type {} }
+    {}
+
+    /**
+     * @brief creates a new instance which consists of exchanges.
+     * @param exchanges the adjacent exchanges
+     */
+    explicit constexpr adjacent_view(exchange_list_view exchanges) noexcept :
+        processes_ { typename process_list_view::cursor_type {}, typename process_list_view::cursor_type {} },
+        exchanges_ { exchanges }
+    {}
+
+    /**
+     * @brief returns whether or not this view is empty.
+     * @return true if this is empty
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return processes_.empty() && exchanges_.empty();
+    }
+
+    /**
+     * @brief returns the number of elements in this view.
+     * @return the number of elements
+     */
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return processes_.size() + exchanges_.size();
+    }
+
+    /**
+     * @brief returns a forward iterator which points the beginning of this sequence.
+     * @return the iterator of beginning (inclusive)
+     */
+    [[nodiscard]] constexpr iterator begin() const noexcept {
+        return iterator { processes_.begin(), processes_.end(), exchanges_.begin() };
+    }
+
+    /**
+     * @brief returns a forward iterator which points the ending of this sequence.
+     * @return the iterator of ending (exclusive)
+     */
+    [[nodiscard]] constexpr iterator end() const noexcept {
+        return iterator { processes_.end(), processes_.end(), exchanges_.end() };
+    }
+
+private:
+    process_list_view processes_;
+    exchange_list_view exchanges_;
+};
+
+/**
+ * @brief returns a lazy view of the upstream steps of the given one.
+ * @details This is equivalent to enumerate_upstream(), but never allocates any objects.
+ * @param s the target step
+ * @return the upstream steps
+ */
+[[nodiscard]] inline adjacent_view<step> upstreams(step& s) noexcept {
+    if (s.kind() == step_kind::process) {
+        return adjacent_view<step> { util::unsafe_downcast<process>(s).upstreams() };
+    }
+    return adjacent_view<step> { util::unsafe_downcast<exchange>(s).upstreams() };
+}
+
+/// @copydoc upstreams()
+[[nodiscard]] inline adjacent_view<step const> upstreams(step const& s) noexcept {
+    if (s.kind() == step_kind::process) {
+        return adjacent_view<step const> { util::unsafe_downcast<process>(s).upstreams() };
+    }
+    return adjacent_view<step const> { util::unsafe_downcast<exchange>(s).upstreams() };
+}
+
+/**
+ * @brief returns a lazy view of the downstream steps of the given one.
+ * @details This is equivalent to enumerate_downstream(), but never allocates any objects.
+ * @param s the target step
+ * @return the downstream steps
+ */
+[[nodiscard]] inline adjacent_view<step> downstreams(step& s) noexcept {
+    if (s.kind() == step_kind::process) {
+        return adjacent_view<step> { util::unsafe_downcast<process>(s).downstreams() };
+    }
+    return adjacent_view<step> { util::unsafe_downcast<exchange>(s).downstreams() };
+}
+
+/// @copydoc downstreams()
+[[nodiscard]] inline adjacent_view<step const> downstreams(step const& s) noexcept {
+    if (s.kind() == step_kind::process) {
+        return adjacent_view<step const> { util::unsafe_downcast<process>(s).downstreams() };
+    }
+    return adjacent_view<step const> { util::unsafe_downcast<exchange>(s).downstreams() };
+}
+
+namespace details {
+
+/**
+ * @private
+ * @brief enumerates upstream steps, for topological sort.
+ */
+struct upstream_enumerator {
+    template<class Step, class Consumer>
+    void operator()(Step& s, Consumer&& consumer) const {
+        for (auto&& e : upstreams(s)) {
+            consumer(e);
+        }
+    }
+};
+
+/**
+ * @private
+ * @brief enumerates downstream steps, for topological sort.
+ */
+struct downstream_enumerator {
+    template<class Step, class Consumer>
+    void operator()(Step& s, Consumer&& consumer) const {
+        for (auto&& e : downstreams(s)) {
+            consumer(e);
+        }
+    }
+};
+
+} // namespace details
+
+/// @brief a lazy topological sorter (from upstream to downstream).
+using upstream_sorter = takatori::graph::topological_sorter<details::upstream_enumerator, graph_type>;
+
+/// @brief a lazy topological sorter (from upstream to downstream) for const graphs.
+using const_upstream_sorter = takatori::graph::topological_sorter<details::upstream_enumerator, graph_type const>;
+
+/// @brief a lazy topological sorter (from downstream to upstream).
+using downstream_sorter = takatori::graph::topological_sorter<details::downstream_enumerator, graph_type>;
+
+/// @brief a lazy topological sorter (from downstream to upstream) for const graphs.
+using const_downstream_sorter = takatori::graph::topological_sorter<details::downstream_enumerator, graph_type const>;
+
+/**
+ * @brief returns a lazy single pass range of the steps in topological order (from upstream to downstream).
+ * @details This yields the same sequence as sort_from_upstream().
+ * @param g the target graph
+ * @return the sorted range
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @attention the graph must not be modified while iterating the range
+ */
+[[nodiscard]] inline upstream_sorter sorted_from_upstream(graph_type& g) {
+    return upstream_sorter { g };
+}
+
+/// @copydoc sorted_from_upstream()
+[[nodiscard]] inline const_upstream_sorter sorted_from_upstream(graph_type const& g) {
+    return const_upstream_sorter { g };
+}
+
+/**
+ * @brief returns a lazy single pass range of the steps in topological order (from downstream to upstream).
+ * @details This yields the same sequence as sort_from_downstream().
+ * @param g the target graph
+ * @return the sorted range
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @attention the graph must not be modified while iterating the range
+ */
+[[nodiscard]] inline downstream_sorter sorted_from_downstream(graph_type& g) {
+    return downstream_sorter { g };
+}
+
+/// @copydoc sorted_from_downstream()
+[[nodiscard]] inline const_downstream_sorter sorted_from_downstream(graph_type const& g) {
+    return const_downstream_sorter { g };
+}
+
+/**
+ * @brief enumerates steps which have no upstreams.
+ * @details This is a template version of enumerate_top(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ */
+template<class Consumer>
+void enumerate_top(graph_type& g, Consumer&& consumer) {
+    for (auto&& s : g) {
+        if (upstreams(s).empty()) {
+            consumer(s);
+        }
+    }
+}
+
+/// @copydoc enumerate_top(graph_type&, Consumer&&)
+template<class Consumer>
+void enumerate_top(graph_type const& g, Consumer&& consumer) {
+    for (step const& s : g) {
+        if (upstreams(s).empty()) {
+            consumer(s);
+        }
+    }
+}
+
+/**
+ * @brief enumerates steps which have no downstreams.
+ * @details This is a template version of enumerate_bottom(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ */
+template<class Consumer>
+void enumerate_bottom(graph_type& g, Consumer&& consumer) {
+    for (auto&& s : g) {
+        if (downstreams(s).empty()) {
+            consumer(s);
+        }
+    }
+}
+
+/// @copydoc enumerate_bottom(graph_type&, Consumer&&)
+template<class Consumer>
+void enumerate_bottom(graph_type const& g, Consumer&& consumer) {
+    for (step const& s : g) {
+        if (downstreams(s).empty()) {
+            consumer(s);
+        }
+    }
+}
+
+/**
+ * @brief enumerates the upstream steps of the given one.
+ * @details This is a template version of enumerate_upstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param s the target step
+ * @param consumer the result consumer
+ * @see upstreams()
+ */
+template<class Consumer>
+void enumerate_upstream(step& s, Consumer&& consumer) {
+    details::upstream_enumerator {}(s, consumer);
+}
+
+/// @copydoc enumerate_upstream(step&, Consumer&&)
+template<class Consumer>
+void enumerate_upstream(step const& s, Consumer&& consumer) {
+    details::upstream_enumerator {}(s, consumer);
+}
+
+/**
+ * @brief enumerates the downstream steps of the given one.
+ * @details This is a template version of enumerate_downstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param s the target step
+ * @param consumer the result consumer
+ * @see downstreams()
+ */
+template<class Consumer>
+void enumerate_downstream(step& s, Consumer&& consumer) {
+    details::downstream_enumerator {}(s, consumer);
+}
+
+/// @copydoc enumerate_downstream(step&, Consumer&&)
+template<class Consumer>
+void enumerate_downstream(step const& s, Consumer&& consumer) {
+    details::downstream_enumerator {}(s, consumer);
+}
+
+/**
+ * @brief apply topological sort (from upstream to downstream) to the graph.
+ * @details This is a template version of sort_from_upstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @see sorted_from_upstream()
+ */
+template<class Consumer>
+void sort_from_upstream(graph_type& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::upstream_enumerator>(g, consumer);
+}
+
+/// @copydoc sort_from_upstream(graph_type&, Consumer&&)
+template<class Consumer>
+void sort_from_upstream(graph_type const& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::upstream_enumerator>(g, consumer);
+}
+
+/**
+ * @brief apply topological sort (from downstream to upstream) to the graph.
+ * @details This is a template version of sort_from_downstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @see sorted_from_downstream()
+ */
+template<class Consumer>
+void sort_from_downstream(graph_type& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::downstream_enumerator>(g, consumer);
+}
+
+/// @copydoc sort_from_downstream(graph_type&, Consumer&&)
+template<class Consumer>
+void sort_from_downstream(graph_type const& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::downstream_enumerator>(g, consumer);
+}
+
+/**
+ * @brief computes the canonical fingerprint of the given graph.
+ * @details The result does not depend on the order or the addresses of steps in the graph,
+ *      so that the isomorphic graphs always have the same fingerprint.
+ *      Each descriptor in the graph is identified by the multi-set of the sites where it occurs in the graph,
+ *      so that the graphs built in the same way from different descriptor objects also have the same fingerprint.
+ *      The fingerprint of each process step also reflects its operator graph.
+ * @param g the target graph
+ * @param mask_literals whether or not ignore the literal values in the graph, except their kind
+ * @return the fingerprint of the graph
+ * @see scalar::expression::fingerprint()
+ */
+[[nodiscard]] util::fingerprint compute_fingerprint(graph_type const& g, bool mask_literals = false);
+
 } // namespace takatori::plan
@@ -2,11 +2,14 @@
 
 #include <ostream>
 
+#include <cstddef>
+
 #include "step_kind.h"
 
 #include <takatori/graph/graph.h>
 
 #include <takatori/util/optional_ptr.h>
+#include <takatori/util/object_memory.h>
 #include <takatori/util/reference_list_view.h>
 
 namespace takatori::plan {
@@ -21,7 +24,7 @@ using step_list_view = util::reference_list_view<util::double_pointer_extractor<
 /**
  * @brief represents a step of execution plan.
  */
-class step {
+class step : public util::object_memory_support {
 public:
     /// @brief the graph type
     using graph_type = graph::graph<step>;
@@ -115,6 +118,13 @@ public:
      */
     void on_leave() noexcept;
 
+    /**
+     * @brief returns the ordinal of this step in the owner graph.
+     * @return the ordinal, which is only valid if this step is a member of the graph
+     * @see graph::graph::ordinal()
+     */
+    [[nodiscard]] std::size_t graph_ordinal() const noexcept;
+
 protected:
     /**
      * @brief creates a new instance.
@@ -139,6 +149,11 @@ protected:
 
 private:
     graph_type* owner_ {};
+    std::size_t graph_ordinal_ { static_cast<std::size_t>(-1) };
+
+    void graph_ordinal(std::size_t ordinal) noexcept;
+
+    friend struct graph::graph_element_traits<step>;
 };
 
 } // namespace takatori::plan
@@ -3,6 +3,8 @@
 #include <memory>
 #include <ostream>
 
+#include <cstddef>
+
 #include "expression_kind.h"
 
 #include <takatori/document/region.h>
@@ -150,6 +152,13 @@ public:
      */
     void on_leave() noexcept;
 
+    /**
+     * @brief returns the ordinal of this expression in the owner graph.
+     * @return the ordinal, which is only valid if this expression is a member of the graph
+     * @see graph::graph::ordinal()
+     */
+    [[nodiscard]] std::size_t graph_ordinal() const noexcept;
+
 protected:
     /**
      * @brief creates a new instance.
@@ -174,7 +183,12 @@ protected:
 
 private:
     graph_type* owner_ {};
+    std::size_t graph_ordinal_ { static_cast<std::size_t>(-1) };
     document::region region_ {};
+
+    void graph_ordinal(std::size_t ordinal) noexcept;
+
+    friend struct graph::graph_element_traits<expression>;
 };
 
 } // namespace takatori::relation
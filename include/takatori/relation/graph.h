@@ -3,7 +3,10 @@
 #include <functional>
 #include <memory>
 
+#include <takatori/graph/adjacent_view.h>
 #include <takatori/graph/graph.h>
+#include <takatori/graph/topological_sort.h>
+#include <takatori/util/fingerprint.h>
 #include <takatori/util/sequence_view.h>
 
 #include "expression.h"
@@ -130,4 +133,265 @@ void sort_from_downstream(graph_type& g, consumer_type const& consumer);
 /// @copydoc sort_from_downstream()
 void sort_from_downstream(graph_type const& g, const_consumer_type const& consumer);
 
+/// @brief a lazy view of upstream expressions.
+using upstream_view = takatori::graph::adjacent_view<expression::input_port_type>;
+
+/// @brief a lazy view of upstream expressions for const objects.
+using const_upstream_view = takatori::graph::adjacent_view<expression::input_port_type const>;
+
+/// @brief a lazy view of downstream expressions.
+using downstream_view = takatori::graph::adjacent_view<expression::output_port_type>;
+
+/// @brief a lazy view of downstream expressions for const objects.
+using const_downstream_view = takatori::graph::adjacent_view<expression::output_port_type const>;
+
+/**
+ * @brief returns a lazy view of the upstream expressions of the given one.
+ * @details This is equivalent to enumerate_upstream(), but never allocates any objects.
+ * @param expr the target expression
+ * @return the upstream expressions, which only consists of the connected ones
+ */
+[[nodiscard]] inline upstream_view upstreams(expression& expr) noexcept {
+    return upstream_view { expr.input_ports() };
+}
+
+/// @copydoc upstreams()
+[[nodiscard]] inline const_upstream_view upstreams(expression const& expr) noexcept {
+    return const_upstream_view { expr.input_ports() };
+}
+
+/**
+ * @brief returns a lazy view of the downstream expressions of the given one.
+ * @details This is equivalent to enumerate_downstream(), but never allocates any objects.
+ * @param expr the target expression
+ * @return the downstream expressions, which only consists of the connected ones
+ */
+[[nodiscard]] inline downstream_view downstreams(expression& expr) noexcept {
+    return downstream_view { expr.output_ports() };
+}
+
+/// @copydoc downstreams()
+[[nodiscard]] inline const_downstream_view downstreams(expression const& expr) noexcept {
+    return const_downstream_view { expr.output_ports() };
+}
+
+namespace details {
+
+/**
+ * @private
+ * @brief enumerates upstream expressions, for topological sort.
+ */
+struct upstream_enumerator {
+    template<class Expr, class Consumer>
+    void operator()(Expr& expr, Consumer&& consumer) const {
+        for (auto&& e : upstreams(expr)) {
+            consumer(e);
+        }
+    }
+};
+
+/**
+ * @private
+ * @brief enumerates downstream expressions, for topological sort.
+ */
+struct downstream_enumerator {
+    template<class Expr, class Consumer>
+    void operator()(Expr& expr, Consumer&& consumer) const {
+        for (auto&& e : downstreams(expr)) {
+            consumer(e);
+        }
+    }
+};
+
+} // namespace details
+
+/// @brief a lazy topological sorter (from upstream to downstream).
+using upstream_sorter = takatori::graph::topological_sorter<details::upstream_enumerator, graph_type>;
+
+/// @brief a lazy topological sorter (from upstream to downstream) for const graphs.
+using const_upstream_sorter = takatori::graph::topological_sorter<details::upstream_enumerator, graph_type const>;
+
+/// @brief a lazy topological sorter (from downstream to upstream).
+using downstream_sorter = takatori::graph::topological_sorter<details::downstream_enumerator, graph_type>;
+
+/// @brief a lazy topological sorter (from downstream to upstream) for const graphs.
+using const_downstream_sorter = takatori::graph::topological_sorter<details::downstream_enumerator, graph_type const>;
+
+/**
+ * @brief returns a lazy single pass range of the expressions in topological order (from upstream to downstream).
+ * @details This yields the same sequence as sort_from_upstream().
+ * @param g the target graph
+ * @return the sorted range
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @attention the graph must not be modified while iterating the range
+ */
+[[nodiscard]] inline upstream_sorter sorted_from_upstream(graph_type& g) {
+    return upstream_sorter { g };
+}
+
+/// @copydoc sorted_from_upstream()
+[[nodiscard]] inline const_upstream_sorter sorted_from_upstream(graph_type const& g) {
+    return const_upstream_sorter { g };
+}
+
+/**
+ * @brief returns a lazy single pass range of the expressions in topological order (from downstream to upstream).
+ * @details This yields the same sequence as sort_from_downstream().
+ * @param g the target graph
+ * @return the sorted range
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @attention the graph must not be modified while iterating the range
+ */
+[[nodiscard]] inline downstream_sorter sorted_from_downstream(graph_type& g) {
+    return downstream_sorter { g };
+}
+
+/// @copydoc sorted_from_downstream()
+[[nodiscard]] inline const_downstream_sorter sorted_from_downstream(graph_type const& g) {
+    return const_downstream_sorter { g };
+}
+
+/**
+ * @brief enumerates expressions which have no upstreams.
+ * @details This is a template version of enumerate_top(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ */
+template<class Consumer>
+void enumerate_top(graph_type& g, Consumer&& consumer) {
+    for (auto&& e : g) {
+        if (e.input_ports().empty()) {
+            consumer(e);
+        }
+    }
+}
+
+/// @copydoc enumerate_top(graph_type&, Consumer&&)
+template<class Consumer>
+void enumerate_top(graph_type const& g, Consumer&& consumer) {
+    for (expression const& e : g) {
+        if (e.input_ports().empty()) {
+            consumer(e);
+        }
+    }
+}
+
+/**
+ * @brief enumerates expressions which have no downstreams.
+ * @details This is a template version of enumerate_bottom(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ */
+template<class Consumer>
+void enumerate_bottom(graph_type& g, Consumer&& consumer) {
+    for (auto&& e : g) {
+        if (e.output_ports().empty()) {
+            consumer(e);
+        }
+    }
+}
+
+/// @copydoc enumerate_bottom(graph_type&, Consumer&&)
+template<class Consumer>
+void enumerate_bottom(graph_type const& g, Consumer&& consumer) {
+    for (expression const& e : g) {
+        if (e.output_ports().empty()) {
+            consumer(e);
+        }
+    }
+}
+
+/**
+ * @brief enumerates the upstream expressions of the given one.
+ * @details This is a template version of enumerate_upstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param expr the target expression
+ * @param consumer the result consumer
+ * @see upstreams()
+ */
+template<class Consumer>
+void enumerate_upstream(expression& expr, Consumer&& consumer) {
+    details::upstream_enumerator {}(expr, consumer);
+}
+
+/// @copydoc enumerate_upstream(expression&, Consumer&&)
+template<class Consumer>
+void enumerate_upstream(expression const& expr, Consumer&& consumer) {
+    details::upstream_enumerator {}(expr, consumer);
+}
+
+/**
+ * @brief enumerates the downstream expressions of the given one.
+ * @details This is a template version of enumerate_downstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param expr the target expression
+ * @param consumer the result consumer
+ * @see downstreams()
+ */
+template<class Consumer>
+void enumerate_downstream(expression& expr, Consumer&& consumer) {
+    details::downstream_enumerator {}(expr, consumer);
+}
+
+/// @copydoc enumerate_downstream(expression&, Consumer&&)
+template<class Consumer>
+void enumerate_downstream(expression const& expr, Consumer&& consumer) {
+    details::downstream_enumerator {}(expr, consumer);
+}
+
+/**
+ * @brief apply topological sort (from upstream to downstream) to the graph.
+ * @details This is a template version of sort_from_upstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @see sorted_from_upstream()
+ */
+template<class Consumer>
+void sort_from_upstream(graph_type& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::upstream_enumerator>(g, consumer);
+}
+
+/// @copydoc sort_from_upstream(graph_type&, Consumer&&)
+template<class Consumer>
+void sort_from_upstream(graph_type const& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::upstream_enumerator>(g, consumer);
+}
+
+/**
+ * @brief apply topological sort (from downstream to upstream) to the graph.
+ * @details This is a template version of sort_from_downstream(), which does not erase the type of consumer.
+ * @tparam Consumer the consumer type
+ * @param g the target graph
+ * @param consumer the destination consumer
+ * @attention if the given graph is cyclic, the result may not be sorted correctly
+ * @see sorted_from_downstream()
+ */
+template<class Consumer>
+void sort_from_downstream(graph_type& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::downstream_enumerator>(g, consumer);
+}
+
+/// @copydoc sort_from_downstream(graph_type&, Consumer&&)
+template<class Consumer>
+void sort_from_downstream(graph_type const& g, Consumer&& consumer) {
+    takatori::graph::topological_sort<details::downstream_enumerator>(g, consumer);
+}
+
+/**
+ * @brief computes the canonical fingerprint of the given graph.
+ * @details The result does not depend on the order or the addresses of operators in the graph,
+ *      so that the isomorphic graphs always have the same fingerprint.
+ *      Each descriptor in the graph is identified by the multi-set of the sites where it occurs in the graph,
+ *      so that the graphs built in the same way from different descriptor objects also have the same fingerprint.
+ * @param g the target graph
+ * @param mask_literals whether or not ignore the literal values in the graph, except their kind
+ * @return the fingerprint of the graph
+ * @see scalar::expression::fingerprint()
+ */
+[[nodiscard]] util::fingerprint compute_fingerprint(graph_type const& g, bool mask_literals = false);
+
 } // namespace takatori::relation
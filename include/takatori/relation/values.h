@@ -1,12 +1,15 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 
 #include <takatori/descriptor/variable.h>
 #include <takatori/scalar/expression.h>
+#include <takatori/scalar/literal_block.h>
 #include <takatori/tree/tree_fragment_vector.h>
 
 #include <takatori/util/clone_tag.h>
+#include <takatori/util/optional_ptr.h>
 #include <takatori/util/rvalue_reference_wrapper.h>
 
 #include "expression.h"
@@ -91,12 +94,40 @@ public:
      * @brief returns the rows to values.
      * @details The individual elements in each row must be ordered by columns().
      * @return the value rows
+     * @attention This does not contain the rows in block(). To handle all rows in the same way,
+     *      call materialize_block() before using this.
      */
     [[nodiscard]] tree::tree_fragment_vector<row>& rows() noexcept;
 
     /// @copydoc rows()
     [[nodiscard]] tree::tree_fragment_vector<row> const& rows() const noexcept;
 
+    /**
+     * @brief returns the columnar block of literals.
+     * @details If this is present, each row of the block represents the individual rows of this operator,
+     *      in addition to the rows().
+     * @return the columnar block
+     * @return empty if this operator has no columnar block
+     * @see materialize_block()
+     */
+    [[nodiscard]] util::optional_ptr<scalar::literal_block const> block() const noexcept;
+
+    /**
+     * @brief sets the columnar block of literals.
+     * @details Copies of this operator share the block instead of copying the individual literals.
+     * @param block the columnar block, its columns must be ordered by columns(); or empty to remove it
+     * @return this
+     * @throws std::invalid_argument if the number of block columns is inconsistent to columns()
+     */
+    values& block(std::shared_ptr<scalar::literal_block const> block);
+
+    /**
+     * @brief expands the columnar block into the tail of rows(), and then removes the block.
+     * @details This does nothing if block() is absent.
+     * @return this
+     */
+    values& materialize_block();
+
     /**
      * @brief returns whether or not the two elements are equivalent.
      * @param a the first element
@@ -131,6 +162,7 @@ private:
     output_port_type output_;
     std::vector<column> columns_;
     tree::tree_fragment_vector<row> rows_;
+    std::shared_ptr<scalar::literal_block const> block_ {};
 };
 
 /**
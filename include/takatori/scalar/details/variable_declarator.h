@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ostream>
+#include <type_traits>
 
 #include <takatori/scalar/expression.h>
 
@@ -145,6 +146,12 @@ public:
      * @return the target variable
      */
     [[nodiscard]] descriptor::variable& variable() noexcept {
+        // may be modified via the returned reference
+        if constexpr (std::is_base_of_v<expression, parent_type>) {
+            if (parent_ != nullptr) {
+                parent_->invalidate_fingerprint();
+            }
+        }
         return variable_;
     }
 
@@ -1,14 +1,19 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <ostream>
 
+#include <cstdint>
+
 #include "expression_kind.h"
 
 #include <takatori/document/region.h>
 
 #include <takatori/tree/tree_element_base.h>
 
+#include <takatori/util/fingerprint.h>
 #include <takatori/util/optional_ptr.h>
 
 namespace takatori::scalar {
@@ -90,6 +95,29 @@ public:
     /// @copydoc region()
     [[nodiscard]] document::region const& region() const noexcept;
 
+    /**
+     * @brief returns the structural fingerprint of this expression.
+     * @details The equivalent expressions always have the same fingerprint, that is,
+     *      `a == b` implies `a.fingerprint() == b.fingerprint()`, but not vice versa.
+     *      The document region is not a part of the fingerprint.
+     *
+     *      The computed fingerprint is cached in each expression, and is invalidated when the expression is modified
+     *      via its setters, or the member expressions are attached or detached.
+     *      Note that, the modification of each member expression also invalidates the fingerprint of this.
+     * @attention If you modify the expression without its setters or tree containers (e.g. rearranging
+     *      elements using their iterators), please call invalidate_fingerprint() to discard the cached value.
+     * @note This does not consume the call stack for nested expressions.
+     * @note This is thread-safe unless another thread is modifying the expression.
+     * @return the fingerprint of this expression
+     */
+    [[nodiscard]] util::fingerprint fingerprint() const;
+
+    /**
+     * @brief discards the cached fingerprint of this expression and its ancestors.
+     * @see fingerprint()
+     */
+    void invalidate_fingerprint() noexcept;
+
     /**
      * @brief returns whether or not the two elements are equivalent.
      * @param a the first element
@@ -135,6 +163,30 @@ protected:
 private:
     parent_type* parent_ {};
     document::region region_ {};
+    mutable std::atomic<std::uint64_t> fingerprint_high_ {};
+    mutable std::atomic<std::uint64_t> fingerprint_low_ {};
+    mutable std::atomic_bool fingerprint_cached_ { false };
+
+    [[nodiscard]] bool find_fingerprint(util::fingerprint& result) const noexcept;
+    void cache_fingerprint(util::fingerprint value) const noexcept;
+
+    friend class fingerprint_engine;
 };
 
 } // namespace takatori::scalar
+
+/**
+ * @brief std::hash specialization for takatori::scalar::expression.
+ */
+template<>
+struct std::hash<takatori::scalar::expression> {
+    /**
+     * @brief compute hash of the given object.
+     * @param value the target object
+     * @return computed hash code
+     * @see takatori::scalar::expression::fingerprint()
+     */
+    std::size_t operator()(takatori::scalar::expression const& value) const {
+        return std::hash<takatori::util::fingerprint> {}(value.fingerprint());
+    }
+};
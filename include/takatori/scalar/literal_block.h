@@ -0,0 +1,408 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <takatori/type/data.h>
+
+#include <takatori/value/data.h>
+#include <takatori/value/value_kind.h>
+#include <takatori/value/primitive.h>
+#include <takatori/value/decimal.h>
+#include <takatori/value/character.h>
+#include <takatori/value/octet.h>
+#include <takatori/value/date.h>
+#include <takatori/value/time_of_day.h>
+#include <takatori/value/time_point.h>
+#include <takatori/value/datetime_interval.h>
+#include <takatori/value/unknown.h>
+
+#include <takatori/util/downcast.h>
+#include <takatori/util/exception.h>
+
+#include "immediate.h"
+
+namespace takatori::scalar {
+
+/**
+ * @brief a columnar block of literals.
+ * @details This represents a table of literals, like rows of `VALUES` clause, in compact form.
+ *      Each column has a shared type, and packs the individual values into contiguous buffers instead of
+ *      holding them as individual objects, so that building a block only requires `O(columns)` allocations.
+ *
+ *      The individual cells can be materialized as scalar::immediate on demand, by using materialize().
+ * @see relation::values
+ * @see statement::write
+ */
+class literal_block {
+public:
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief a column of literal_block.
+     * @details The values in column are packed if their kind is same to the first non-null value in the column,
+     *      and its kind is one of boolean, int4, int8, float4, float8, decimal, character, octet, date, time_of_day,
+     *      time_point, or datetime_interval. The other values are kept as individual objects.
+     */
+    class column {
+    public:
+        /// @brief the size type.
+        using size_type = literal_block::size_type;
+
+        /**
+         * @brief creates a new instance.
+         * @param type the column type, which is shared by all values in this column
+         */
+        explicit column(std::shared_ptr<type::data const> type) noexcept;
+
+        /**
+         * @brief returns the column type.
+         * @return the column type
+         * @warning undefined behavior if the type is absent
+         */
+        [[nodiscard]] type::data const& type() const noexcept;
+
+        /**
+         * @brief returns the column type for share it.
+         * @return the column type for sharing
+         * @return empty if the type is absent
+         */
+        [[nodiscard]] std::shared_ptr<type::data const> const& shared_type() const noexcept;
+
+        /**
+         * @brief returns the number of values in this column.
+         * @return the number of values
+         */
+        [[nodiscard]] size_type size() const noexcept;
+
+        /**
+         * @brief returns the kind of the packed values in this column.
+         * @return the packed value kind
+         * @return empty if there are no packed values
+         */
+        [[nodiscard]] std::optional<value::value_kind> packed_kind() const noexcept;
+
+        /**
+         * @brief returns the value kind on the given row.
+         * @param row the row index
+         * @return the value kind, or value_kind::unknown if the value is null
+         * @throws std::out_of_range if the row is out of range
+         */
+        [[nodiscard]] value::value_kind kind(size_type row) const;
+
+        /**
+         * @brief returns whether or not the value on the given row is null.
+         * @param row the row index
+         * @return true if it is null
+         * @return false otherwise
+         * @throws std::out_of_range if the row is out of range
+         */
+        [[nodiscard]] bool is_null(size_type row) const;
+
+        /**
+         * @brief returns the view of value on the given row, without creating value objects.
+         * @tparam Kind the value kind
+         * @param row the row index
+         * @return the value view
+         * @throws std::out_of_range if the row is out of range
+         * @throws std::invalid_argument if the value on the row is not the given kind
+         */
+        template<value::value_kind Kind>
+        [[nodiscard]] typename value::type_of_t<Kind>::view_type get(size_type row) const {
+            auto state = state_at(row);
+            if (state == cell_state::packed ? packed_kind_ != Kind : state != cell_state::boxed) {
+                util::throw_exception(std::invalid_argument("inconsistent value kind"));
+            }
+            if (state == cell_state::boxed && boxed_at(row).kind() != Kind) {
+                util::throw_exception(std::invalid_argument("inconsistent value kind"));
+            }
+            return view_at<Kind>(row);
+        }
+
+        /**
+         * @brief passes the value on the given row to the consumer.
+         * @details If the value is packed, this passes a temporary value object on the stack instead of
+         *      creating it on the heap, so that the consumer must not retain the passed object.
+         * @tparam Consumer the consumer type, which accepts `value::data const&`
+         * @param row the row index
+         * @param consumer the value consumer
+         * @throws std::out_of_range if the row is out of range
+         */
+        template<class Consumer>
+        void visit(size_type row, Consumer&& consumer) const {
+            using k = value::value_kind;
+            switch (state_at(row)) {
+                case cell_state::null: {
+                    value::unknown null_value { value::unknown_kind::null };
+                    consumer(static_cast<value::data const&>(null_value));
+                    return;
+                }
+                case cell_state::boxed:
+                    consumer(boxed_at(row));
+                    return;
+                case cell_state::packed:
+                    break;
+            }
+            switch (*packed_kind_) {
+                case k::boolean: visit_packed<value::boolean>(row, consumer); return;
+                case k::int4: visit_packed<value::int4>(row, consumer); return;
+                case k::int8: visit_packed<value::int8>(row, consumer); return;
+                case k::float4: visit_packed<value::float4>(row, consumer); return;
+                case k::float8: visit_packed<value::float8>(row, consumer); return;
+                case k::decimal: visit_packed<value::decimal>(row, consumer); return;
+                case k::character: visit_packed<value::character>(row, consumer); return;
+                case k::octet: visit_packed<value::octet>(row, consumer); return;
+                case k::date: visit_packed<value::date>(row, consumer); return;
+                case k::time_of_day: visit_packed<value::time_of_day>(row, consumer); return;
+                case k::time_point: visit_packed<value::time_point>(row, consumer); return;
+                case k::datetime_interval: visit_packed<value::datetime_interval>(row, consumer); return;
+                default: break;
+            }
+            std::abort();
+        }
+
+        /**
+         * @brief returns the value on the given row.
+         * @details This may create a new value object.
+         * @param row the row index
+         * @return the value, or value::unknown if the value is null
+         * @throws std::out_of_range if the row is out of range
+         */
+        [[nodiscard]] std::shared_ptr<value::data const> value(size_type row) const;
+
+        /**
+         * @brief appends a value into tail of this column.
+         * @param value the value to append
+         */
+        void append(value::data const& value);
+
+        /**
+         * @brief appends a null value into tail of this column.
+         */
+        void append_null();
+
+        /**
+         * @brief reserves the buffer for the given number of values.
+         * @param size the number of values
+         */
+        void reserve(size_type size);
+
+    private:
+        enum class cell_state : std::uint8_t {
+            null,
+            packed,
+            boxed,
+        };
+
+        struct varlen_slot {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        std::shared_ptr<type::data const> type_;
+        std::optional<value::value_kind> packed_kind_ {};
+        std::size_t stride_ {};
+        std::vector<cell_state> states_ {};
+        std::vector<std::byte> slots_ {};
+        std::string arena_ {};
+        std::vector<std::pair<size_type, std::shared_ptr<value::data const>>> boxed_ {};
+
+        [[nodiscard]] static constexpr bool is_fixed(value::value_kind kind) noexcept {
+            using k = value::value_kind;
+            switch (kind) {
+                case k::boolean:
+                case k::int4:
+                case k::int8:
+                case k::float4:
+                case k::float8:
+                case k::decimal:
+                case k::date:
+                case k::time_of_day:
+                case k::time_point:
+                case k::datetime_interval:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        [[nodiscard]] static constexpr bool is_variable(value::value_kind kind) noexcept {
+            return kind == value::value_kind::character || kind == value::value_kind::octet;
+        }
+
+        [[nodiscard]] cell_state state_at(size_type row) const;
+        [[nodiscard]] std::byte const* slot(size_type row) const noexcept;
+        [[nodiscard]] value::data const& boxed_at(size_type row) const noexcept;
+
+        // NOTE: the cell must be a packed value of Kind, or a boxed value of Kind
+        template<value::value_kind Kind>
+        [[nodiscard]] typename value::type_of_t<Kind>::view_type view_at(size_type row) const noexcept {
+            using value_type = value::type_of_t<Kind>;
+            if (states_[row] == cell_state::packed) {
+                if constexpr (is_fixed(Kind)) {
+                    typename value_type::entity_type result {};
+                    std::memcpy(std::addressof(result), slot(row), sizeof(result));
+                    return result;
+                } else if constexpr (is_variable(Kind)) {
+                    varlen_slot entry {};
+                    std::memcpy(std::addressof(entry), slot(row), sizeof(entry));
+                    return std::string_view { arena_.data() + entry.offset, entry.size }; // NOLINT
+                }
+            }
+            return util::unsafe_downcast<value_type>(boxed_at(row)).get();
+        }
+
+        template<class T, class Consumer>
+        void visit_packed(size_type row, Consumer& consumer) const {
+            T value { typename T::entity_type { view_at<T::tag>(row) } };
+            consumer(static_cast<value::data const&>(value));
+        }
+
+        [[nodiscard]] static bool cell_equals(column const& a, column const& b, size_type row) noexcept;
+
+        void pack(value::data const& value);
+        template<class T> void pack_fixed(value::data const& value);
+        template<class T> void pack_variable(value::data const& value);
+        template<class T> std::shared_ptr<value::data const> unpack(size_type row) const;
+
+        void truncate(size_type rows) noexcept;
+
+        friend class literal_block;
+        friend bool operator==(column const& a, column const& b) noexcept;
+    };
+
+    /**
+     * @brief creates a new empty block.
+     */
+    literal_block() = default;
+
+    /**
+     * @brief creates a new empty block.
+     * @param types the column types
+     */
+    explicit literal_block(std::vector<std::shared_ptr<type::data const>> types);
+
+    /**
+     * @brief returns the columns.
+     * @return the columns
+     */
+    [[nodiscard]] std::vector<column> const& columns() const noexcept;
+
+    /**
+     * @brief returns the number of rows in this block.
+     * @return the number of rows
+     */
+    [[nodiscard]] size_type row_count() const noexcept;
+
+    /**
+     * @brief reserves the buffer for the given number of rows.
+     * @param rows the number of rows
+     */
+    void reserve(size_type rows);
+
+    /**
+     * @brief appends a row into this block.
+     * @tparam Values the value types
+     * @param values the individual values, must be ordered by columns()
+     * @return this
+     * @throws std::invalid_argument if the number of values is inconsistent to the number of columns
+     * @note If this operation was failed, this block is not modified.
+     */
+    template<class... Values>
+    literal_block& add_row(Values const&... values) {
+        static_assert((std::is_base_of_v<value::data, Values> && ...));
+        if (sizeof...(Values) != columns_.size()) {
+            util::throw_exception(std::invalid_argument("inconsistent number of values"));
+        }
+        auto rows = row_count();
+        try {
+            size_type index = 0;
+            (columns_[index++].append(values), ...);
+        } catch (...) {
+            rollback(rows);
+            throw;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief appends a row into this block.
+     * @param values the individual values, must be ordered by columns(), or nullptr to represent null
+     * @return this
+     * @throws std::invalid_argument if the number of values is inconsistent to the number of columns
+     * @note If this operation was failed, this block is not modified.
+     */
+    literal_block& add_row(std::vector<value::data const*> const& values);
+
+    /**
+     * @brief creates an immediate expression of the given cell.
+     * @param row the row index
+     * @param column the column index
+     * @return the created expression
+     * @throws std::out_of_range if the cell is out of range
+     */
+    [[nodiscard]] std::unique_ptr<immediate> materialize(size_type row, size_type column) const;
+
+    /**
+     * @brief returns whether or not the two blocks are equivalent.
+     * @param a the first block
+     * @param b the second block
+     * @return true if a == b
+     * @return false otherwise
+     */
+    friend bool operator==(literal_block const& a, literal_block const& b) noexcept;
+
+    /**
+     * @brief returns whether or not the two blocks are different.
+     * @param a the first block
+     * @param b the second block
+     * @return true if a != b
+     * @return false otherwise
+     */
+    friend bool operator!=(literal_block const& a, literal_block const& b) noexcept;
+
+    /**
+     * @brief appends string representation of the given value.
+     * @param out the target output
+     * @param value the target value
+     * @return the output
+     */
+    friend std::ostream& operator<<(std::ostream& out, literal_block const& value);
+
+private:
+    std::vector<column> columns_ {};
+
+    void rollback(size_type rows) noexcept;
+};
+
+/**
+ * @brief returns whether or not the two columns are equivalent.
+ * @param a the first column
+ * @param b the second column
+ * @return true if a == b
+ * @return false otherwise
+ */
+bool operator==(literal_block::column const& a, literal_block::column const& b) noexcept;
+
+/**
+ * @brief returns whether or not the two columns are different.
+ * @param a the first column
+ * @param b the second column
+ * @return true if a != b
+ * @return false otherwise
+ */
+bool operator!=(literal_block::column const& a, literal_block::column const& b) noexcept;
+
+} // namespace takatori::scalar
@@ -2,9 +2,11 @@
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 #include "dispatch.h"
 
+#include <takatori/util/infect_qualifier.h>
 #include <takatori/util/post_visit.h>
 
 namespace takatori::scalar {
@@ -13,250 +15,134 @@ namespace impl {
 
 /**
  * @private
- * @brief walks over takatori::scalar models.
+ * @brief invokes the pre-visit callback for takatori::scalar models.
  */
-class walker_adapter {
+class walker_pre_adapter {
 public:
-    template<class Callback, class... Args>
-    void operator()(immediate& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(immediate const& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(variable_reference& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(variable_reference const& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(unary& expr, Callback&& callback, Args&&... args) {
-        do_unary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(unary const& expr, Callback&& callback, Args&&... args) {
-        do_unary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(cast& expr, Callback&& callback, Args&&... args) {
-        do_unary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(cast const& expr, Callback&& callback, Args&&... args) {
-        do_unary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(binary& expr, Callback&& callback, Args&&... args) {
-        do_binary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(binary const& expr, Callback&& callback, Args&&... args) {
-        do_binary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(compare& expr, Callback&& callback, Args&&... args) {
-        do_binary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(compare const& expr, Callback&& callback, Args&&... args) {
-        do_binary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(match& expr, Callback&& callback, Args&&... args) {
-        do_match(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(match const& expr, Callback&& callback, Args&&... args) {
-        do_match(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(conditional& expr, Callback&& callback, Args&&... args) {
-        do_conditional(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(conditional const& expr, Callback&& callback, Args&&... args) {
-        do_conditional(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(coalesce& expr, Callback&& callback, Args&&... args) {
-        do_coalesce(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(coalesce const& expr, Callback&& callback, Args&&... args) {
-        do_coalesce(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(let& expr, Callback&& callback, Args&&... args) {
-        do_let(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(let const& expr, Callback&& callback, Args&&... args) {
-        do_let(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(function_call& expr, Callback&& callback, Args&&... args) {
-        do_function_call(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(function_call const& expr, Callback&& callback, Args&&... args) {
-        do_function_call(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(extension& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class... Args>
-    void operator()(extension const& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void operator()(Expr& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
     template<class Callback, class Expr, class... Args>
-    void operator()(Expr const& expr, Callback&& callback, Args&&... args) {
-        do_nullary(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
-    }
-
-private:
-    template<class Callback, class Expr, class... Args>
-    bool do_pre(Callback&& callback, Expr&& expr, Args&&... args) {
-        if constexpr (std::is_same_v<std::invoke_result_t<Callback, Expr, Args...>, void>) { // NOLINT
-            std::invoke(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
+    bool operator()(Expr& expr, Callback&& callback, Args&&... args) {
+        if constexpr (std::is_same_v<std::invoke_result_t<Callback, Expr&, Args...>, void>) { // NOLINT
+            std::invoke(std::forward<Callback>(callback), expr, std::forward<Args>(args)...);
             return true;
         } else { // NOLINT
-            return std::invoke(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_post(Callback&& callback, Expr&& expr, Args&&... args) {
-        if constexpr (std::is_invocable_v<Callback, util::post_visit, Expr, Args...>) {
-            std::invoke(std::forward<Callback>(callback), util::post_visit {}, std::forward<Expr>(expr), std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_member(Callback&& callback, Expr&& expr, Args&&... args) {
-        scalar::dispatch(*this, std::forward<Expr>(expr), std::forward<Callback>(callback), std::forward<Args>(args)...);
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_member(Callback&& callback, util::optional_ptr<Expr> expr, Args&&... args) {
-        if (expr) {
-            do_member(std::forward<Callback>(callback), *expr, std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_nullary(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            do_post(
-                    std::forward<Callback>(callback),
-                    std::forward<Expr>(expr),
-                    std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_unary(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            do_member(std::forward<Callback>(callback), expr.operand(), std::forward<Args>(args)...);
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_binary(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            do_member(std::forward<Callback>(callback), expr.left(), std::forward<Args>(args)...);
-            do_member(std::forward<Callback>(callback), expr.right(), std::forward<Args>(args)...);
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
+            return static_cast<bool>(std::invoke(std::forward<Callback>(callback), expr, std::forward<Args>(args)...));
         }
     }
+};
 
+/**
+ * @private
+ * @brief invokes the post-visit callback for takatori::scalar models.
+ */
+class walker_post_adapter {
+public:
     template<class Callback, class Expr, class... Args>
-    void do_match(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            do_member(std::forward<Callback>(callback), expr.input(), std::forward<Args>(args)...);
-            do_member(std::forward<Callback>(callback), expr.pattern(), std::forward<Args>(args)...);
-            do_member(std::forward<Callback>(callback), expr.escape(), std::forward<Args>(args)...);
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
+    void operator()(Expr& expr, Callback&& callback, Args&&... args) {
+        if constexpr (std::is_invocable_v<Callback, util::post_visit, Expr&, Args...>) {
+            std::invoke(std::forward<Callback>(callback), util::post_visit {}, expr, std::forward<Args>(args)...);
         }
     }
+};
 
-    template<class Callback, class Expr, class... Args>
-    void do_conditional(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            for (auto&& alternative : expr.alternatives()) {
-                do_member(std::forward<Callback>(callback), alternative.condition(), std::forward<Args>(args)...);
-                do_member(std::forward<Callback>(callback), alternative.body(), std::forward<Args>(args)...);
+/**
+ * @private
+ * @brief provides member expressions of takatori::scalar models.
+ */
+class walker_member_adapter {
+public:
+    /**
+     * @brief returns the member expression at the given index.
+     * @param expr the owner expression
+     * @param index the member index
+     * @return pointer to the member
+     * @return nullptr if there are no more members
+     */
+    template<class Expr>
+    util::infect_const_t<Expr, expression>* operator()(Expr& expr, std::size_t index) {
+        using type = std::remove_const_t<Expr>;
+        if constexpr (std::is_same_v<type, unary> || std::is_same_v<type, cast>) { // NOLINT(bugprone-branch-clone)
+            if (index == 0) {
+                return std::addressof(expr.operand());
             }
-            do_member(std::forward<Callback>(callback), expr.default_expression(), std::forward<Args>(args)...);
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_coalesce(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            for (auto&& e : expr.alternatives()) {
-                do_member(std::forward<Callback>(callback), e, std::forward<Args>(args)...);
+        } else if constexpr (std::is_same_v<type, binary> || std::is_same_v<type, compare>) {
+            switch (index) {
+                case 0: return std::addressof(expr.left());
+                case 1: return std::addressof(expr.right());
+                default: break;
             }
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
-        }
-    }
-
-    template<class Callback, class Expr, class... Args>
-    void do_let(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            for (auto&& decl : expr.variables()) {
-                do_member(std::forward<Callback>(callback), decl.value(), std::forward<Args>(args)...);
+        } else if constexpr (std::is_same_v<type, match>) {
+            switch (index) {
+                case 0: return std::addressof(expr.input());
+                case 1: return std::addressof(expr.pattern());
+                case 2: return std::addressof(expr.escape());
+                default: break;
+            }
+        } else if constexpr (std::is_same_v<type, conditional>) {
+            auto&& alternatives = expr.alternatives();
+            if (index < alternatives.size() * 2) {
+                auto&& alternative = alternatives[index / 2];
+                if (index % 2 == 0) {
+                    return std::addressof(alternative.condition());
+                }
+                return std::addressof(alternative.body());
+            }
+            if (index == alternatives.size() * 2) {
+                return expr.default_expression().get();
+            }
+        } else if constexpr (std::is_same_v<type, coalesce>) {
+            auto&& alternatives = expr.alternatives();
+            if (index < alternatives.size()) {
+                return std::addressof(alternatives[index]);
+            }
+        } else if constexpr (std::is_same_v<type, let>) {
+            auto&& variables = expr.variables();
+            if (index < variables.size()) {
+                return std::addressof(variables[index].value());
+            }
+            if (index == variables.size()) {
+                return std::addressof(expr.body());
+            }
+        } else if constexpr (std::is_same_v<type, function_call>) {
+            auto&& arguments = expr.arguments();
+            if (index < arguments.size()) {
+                return std::addressof(arguments[index]);
             }
-            do_member(std::forward<Callback>(callback), expr.body(), std::forward<Args>(args)...);
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
         }
+        return nullptr;
     }
+};
 
-    template<class Callback, class Expr, class... Args>
-    void do_function_call(Callback&& callback, Expr&& expr, Args&&... args) {
-        if (do_pre(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...)) {
-            for (auto&& arg : expr.arguments()) {
-                do_member(std::forward<Callback>(callback), arg, std::forward<Args>(args)...);
+/**
+ * @private
+ * @brief walks over takatori::scalar models without recursive calls.
+ * @details Each member expression is obtained just before visiting it,
+ *      so that the callbacks can modify the members which are not visited yet, as same as recursive walk.
+ */
+template<class Callback, class E, class... Args>
+inline void walk_expression(Callback&& callback, E& object, Args&&... args) {
+    struct frame {
+        E* expr;
+        std::size_t next_member;
+    };
+    if (!dispatch(walker_pre_adapter {}, object, std::forward<Callback>(callback), std::forward<Args>(args)...)) {
+        return;
+    }
+    std::vector<frame> stack {};
+    stack.emplace_back(frame { std::addressof(object), 0 });
+    while (!stack.empty()) {
+        auto&& top = stack.back();
+        if (auto* member = dispatch(walker_member_adapter {}, *top.expr, top.next_member); member != nullptr) {
+            ++top.next_member;
+            if (dispatch(walker_pre_adapter {}, *member, std::forward<Callback>(callback), std::forward<Args>(args)...)) {
+                stack.emplace_back(frame { member, 0 });
             }
-            do_post(std::forward<Callback>(callback), std::forward<Expr>(expr), std::forward<Args>(args)...);
+            continue;
         }
+        auto* expr = top.expr;
+        stack.pop_back();
+        dispatch(walker_post_adapter {}, *expr, std::forward<Callback>(callback), std::forward<Args>(args)...);
     }
-};
+}
 
 } // namespace impl
 
@@ -275,6 +161,8 @@ using util::post_visit;
  *      or declare Callback::operator()(expression&, Args...) as "default" callback function.
  * @note The result type of each callback function can be `void` instead of `bool`.
  *      In that case, this considers as if it always returns `true`.
+ * @note This does not consume the call stack for nested expressions,
+ *      so that it can visit very deep expressions.
  * @tparam Callback the callback object type
  * @tparam Args the callback argument types
  * @param callback the callback object
@@ -283,8 +171,7 @@ using util::post_visit;
  */
 template<class Callback, class... Args>
 inline void walk(Callback&& callback, expression& object, Args&&... args) {
-    impl::walker_adapter adapter;
-    dispatch(adapter, object, std::forward<Callback>(callback), std::forward<Args>(args)...);
+    impl::walk_expression(std::forward<Callback>(callback), object, std::forward<Args>(args)...);
 }
 
 /**
@@ -299,6 +186,8 @@ inline void walk(Callback&& callback, expression& object, Args&&... args) {
  *      or declare Callback::operator()(expression const&, Args...) as "default" callback function.
  * @note The result type of each callback function can be `void` instead of `bool`.
  *      In that case, this considers as if it always returns `true`.
+ * @note This does not consume the call stack for nested expressions,
+ *      so that it can visit very deep expressions.
  * @tparam Callback the callback object type
  * @tparam Args the callback argument types
  * @param callback the callback object
@@ -307,8 +196,7 @@ inline void walk(Callback&& callback, expression& object, Args&&... args) {
  */
 template<class Callback, class... Args>
 inline void walk(Callback&& callback, expression const& object, Args&&... args) {
-    impl::walker_adapter adapter;
-    dispatch(adapter, object, std::forward<Callback>(callback), std::forward<Args>(args)...);
+    impl::walk_expression(std::forward<Callback>(callback), object, std::forward<Args>(args)...);
 }
 
 } // namespace takatori::scalar
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+namespace takatori::serializer {
+
+/**
+ * @brief a writer which batches small write requests into fewer writes of the backing writer.
+ * @details The requests are accumulated in the internal buffer, and they are written into the backing writer
+ *      only if the buffer becomes full, or flush() is called.
+ *      Each request which is larger than the buffer capacity is passed to the backing writer directly.
+ * @attention Please call flush() after the last write request, or the buffered contents will be lost.
+ * @note The results of the backing writer are discarded, so that it should report errors via exceptions.
+ * @tparam Writer the backed writer type, should declare `T::write(char const* data, size_type size)`
+ * @tparam Size the size type represents the number of bytes to write
+ * @see value_writer
+ */
+template<class Writer, class Size = std::uint32_t>
+class buffered_writer {
+public:
+    /// @brief the backed writer type.
+    using writer_type = Writer;
+
+    /// @brief Size the size type represents the number of bytes to write.
+    using size_type = Size;
+
+    /// @brief the default buffer capacity in bytes.
+    static constexpr std::size_t default_capacity = 8192;
+
+    /**
+     * @brief creates a new instance.
+     * @param writer the destination writer
+     * @param capacity the buffer capacity in bytes
+     */
+    explicit buffered_writer(writer_type& writer, std::size_t capacity = default_capacity) :
+        writer_ { std::addressof(writer) },
+        capacity_ { capacity }
+    {
+        buffer_.reserve(capacity_);
+    }
+
+    /**
+     * @brief writes the given contents.
+     * @param data pointer to the contents
+     * @param size the number of bytes to write
+     */
+    void write(char const* data, size_type size) {
+        if (size >= capacity_) {
+            flush();
+            writer_->write(data, size);
+            return;
+        }
+        if (buffer_.size() + size > capacity_) {
+            flush();
+        }
+        buffer_.insert(buffer_.end(), data, data + size); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief writes the buffered contents into the backing writer.
+     */
+    void flush() {
+        if (!buffer_.empty()) {
+            writer_->write(buffer_.data(), static_cast<size_type>(buffer_.size()));
+            buffer_.clear();
+        }
+    }
+
+    /**
+     * @brief returns the number of bytes in the buffer, which are not written into the backing writer yet.
+     * @return the number of buffered bytes
+     */
+    [[nodiscard]] std::size_t buffered_size() const noexcept {
+        return buffer_.size();
+    }
+
+private:
+    writer_type* writer_;
+    std::size_t capacity_;
+    std::vector<char> buffer_ {};
+};
+
+} // namespace takatori::serializer
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <cstdint>
+
+#include <takatori/decimal/triple.h>
+
+#include <takatori/datetime/date.h>
+#include <takatori/datetime/time_of_day.h>
+#include <takatori/datetime/time_point.h>
+
+#include <takatori/relation/sort_direction.h>
+
+#include <takatori/value/data.h>
+#include <takatori/value/value_kind.h>
+
+#include <takatori/util/buffer_view.h>
+
+#include "null_order.h"
+
+namespace takatori::serializer {
+
+/*
+ * Key encoding:
+ *
+ * Unlike value_output, the encoded keys are designed for comparison rather than transport:
+ * for any values `a` and `b` of the same kind, the byte-wise comparison (`memcmp`) of their keys has the same
+ * result as the comparison of the values in the given sort direction.
+ * Each field is self-delimiting, so that the concatenation of fields is also comparable as a composite key.
+ *
+ * Each field starts with a marker octet, which is never affected by the sort direction:
+ * - `0x00` - null, if the null order is first
+ * - `0x01` - non-null value, followed by its body
+ * - `0x02` - null, if the null order is last
+ *
+ * The body octets are complemented if the sort direction is descendant.
+ */
+
+/**
+ * @brief appends a null key field.
+ * @param output the destination
+ * @param nulls the null order
+ */
+void write_key_null(std::string& output, null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `boolean` key field.
+ * @details The body is a single octet, `false` precedes `true`.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_boolean(
+        bool value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends an `int4` key field.
+ * @details The body is 4 octets of the big-endian value whose sign bit is flipped.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_int4(
+        std::int32_t value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends an `int8` key field.
+ * @details The body is 8 octets of the big-endian value whose sign bit is flipped.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_int8(
+        std::int64_t value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `float4` key field.
+ * @details The body is 4 octets of the big-endian IEEE 754 representation, which are adjusted to be ordered.
+ * @note `-0.0` is written as `+0.0`, and all NaNs are written as a positive quiet NaN, which follows `+infinity`.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_float4(
+        float value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `float8` key field.
+ * @details The body is 8 octets of the big-endian IEEE 754 representation, which are adjusted to be ordered.
+ * @note `-0.0` is written as `+0.0`, and all NaNs are written as a positive quiet NaN, which follows `+infinity`.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_float8(
+        double value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `decimal` key field.
+ * @details The body consists of the sign class octet, the adjusted exponent, and the significant digits,
+ *      so that the numerically equivalent values (e.g. `1.0` and `1.00`) have the same key.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ * @see read_key_decimal()
+ */
+void write_key_decimal(
+        decimal::triple value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `character` key field.
+ * @details The body is the octets of the string, where `0x00` is escaped as `0x00 0xff`,
+ *      and terminated by `0x00 0x00`.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_character(
+        std::string_view value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends an `octet` key field.
+ * @details The body is the same format as write_key_character().
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_octet(
+        std::string_view value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `date` key field.
+ * @details The body is the same format as write_key_int8() of the days since epoch.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_date(
+        datetime::date value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `time_of_day` key field.
+ * @details The body is 8 octets of the big-endian nanoseconds since 00:00:00.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_time_of_day(
+        datetime::time_of_day value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a `time_point` key field.
+ * @details The body is the same format as write_key_int8() of the seconds since epoch,
+ *      followed by 4 octets of the big-endian nanosecond adjustment.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ */
+void write_key_time_point(
+        datetime::time_point value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief appends a key field of the given value.
+ * @details This writes a null key field if the value is `unknown`.
+ * @param value the value to write
+ * @param output the destination
+ * @param direction the sort direction
+ * @param nulls the null order
+ * @throws std::invalid_argument if the value kind is not supported
+ */
+void write_key(
+        value::data const& value,
+        std::string& output,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief retrieves a `boolean` key field.
+ * @details This operation will advance the buffer iterator to the next field, only if it is successfully completed.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param direction the sort direction of the field
+ * @param nulls the null order of the field
+ * @return the retrieved value
+ * @return empty if the field is null
+ * @throws value_input_exception if the field is malformed
+ */
+std::optional<bool> read_key_boolean(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<std::int32_t> read_key_int4(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<std::int64_t> read_key_int8(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<float> read_key_float4(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<double> read_key_float8(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief retrieves a `decimal` key field.
+ * @details This operation will advance the buffer iterator to the next field, only if it is successfully completed.
+ * @note The retrieved value is normalized, that is, its coefficient has no trailing zeros,
+ *      and zero is retrieved as `0E0`.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param direction the sort direction of the field
+ * @param nulls the null order of the field
+ * @return the retrieved value
+ * @return empty if the field is null
+ * @throws value_input_exception if the field is malformed
+ */
+std::optional<decimal::triple> read_key_decimal(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief retrieves a `character` key field.
+ * @details This operation will advance the buffer iterator to the next field, only if it is successfully completed.
+ * @note The returned string is a copy, because the field contents are escaped.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param direction the sort direction of the field
+ * @param nulls the null order of the field
+ * @return the retrieved value
+ * @return empty if the field is null
+ * @throws value_input_exception if the field is malformed
+ */
+std::optional<std::string> read_key_character(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_character()
+std::optional<std::string> read_key_octet(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<datetime::date> read_key_date(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<datetime::time_of_day> read_key_time_of_day(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/// @copydoc read_key_boolean()
+std::optional<datetime::time_point> read_key_time_point(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+/**
+ * @brief retrieves a key field of the given kind.
+ * @details This operation will advance the buffer iterator to the next field, only if it is successfully completed.
+ * @param kind the value kind of the field
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param direction the sort direction of the field
+ * @param nulls the null order of the field
+ * @return the retrieved value, or `unknown` if the field is null
+ * @throws std::invalid_argument if the value kind is not supported
+ * @throws value_input_exception if the field is malformed
+ */
+std::unique_ptr<value::data> read_key(
+        value::value_kind kind,
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        relation::sort_direction direction = relation::sort_direction::ascendant,
+        null_order nulls = null_order::first);
+
+} // namespace takatori::serializer
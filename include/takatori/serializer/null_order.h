@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdlib>
+
+#include <ostream>
+#include <string_view>
+
+namespace takatori::serializer {
+
+/// @brief represents where null values are placed in the ordered keys.
+enum class null_order {
+
+    /// @brief null values precede any other values.
+    first,
+
+    /// @brief null values follow any other values.
+    last,
+};
+
+/**
+ * @brief returns string representation of the value.
+ * @param value the target value
+ * @return the corresponded string representation
+ */
+constexpr inline std::string_view to_string_view(null_order value) noexcept {
+    using namespace std::string_view_literals;
+    using kind = null_order;
+    switch (value) {
+        case kind::first: return "first"sv;
+        case kind::last: return "last"sv;
+    }
+    std::abort();
+}
+
+/**
+ * @brief appends string representation of the given value.
+ * @param out the target output
+ * @param value the target value
+ * @return the output
+ */
+inline std::ostream& operator<<(std::ostream& out, null_order value) {
+    return out << to_string_view(value);
+}
+
+} // namespace takatori::serializer
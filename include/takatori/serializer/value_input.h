@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <vector>
+
 #include <boost/dynamic_bitset.hpp>
 
 #include <takatori/decimal/triple.h>
@@ -13,6 +15,8 @@
 
 #include <takatori/util/bitset_view.h>
 #include <takatori/util/buffer_view.h>
+#include <takatori/util/either.h>
+#include <takatori/util/sequence_view.h>
 
 #include "entry_type.h"
 #include "value_input_exception.h"
@@ -218,6 +222,284 @@ std::size_t read_array_begin(util::buffer_view::const_iterator& position, util::
  */
 std::size_t read_row_begin(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end);
 
-// FIXME: impl blob, clob
+/**
+ * @brief retrieves `clob` entry on the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @note The returned std::string_view refers onto the input buffer.
+ *      Please escape the returned value before the buffer will be disposed.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the retrieved value
+ * @throws std::runtime_error if the entry is not expected type
+ * @throws value_input_exception if the encoded value is not valid
+ * @see peek_type()
+ */
+std::string_view read_clob(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end);
+
+/**
+ * @brief retrieves `blob` entry on the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @note The returned std::string_view refers onto the input buffer.
+ *      Please escape the returned value before the buffer will be disposed.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the retrieved value
+ * @throws std::runtime_error if the entry is not expected type
+ * @throws value_input_exception if the encoded value is not valid
+ * @see peek_type()
+ */
+std::string_view read_blob(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end);
+
+/**
+ * @brief skips the entry on the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ *      If the entry is `row` or `array`, this also skips all of its elements, including nested ones.
+ *      This only inspects entry headers and length information, and never copies the entry contents.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @throws value_input_exception if the encoded value is not valid
+ * @see index_elements()
+ */
+void skip_entry(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end);
+
+/**
+ * @brief builds the offset index of elements in the `row` or `array` entry on the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ *      The individual offsets are relative to the beginning of the `row` or `array` entry,
+ *      that is, `position + offsets[i]` points the `i`-th element (0-origin) before calling this operation.
+ *      Each element is skipped as skip_entry(), so that the callers can read only the required elements
+ *      without decoding the others.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param offsets the destination of element offsets, its contents will be replaced
+ * @return the number of elements
+ * @throws std::runtime_error if the entry is neither `row` nor `array`
+ * @throws value_input_exception if the encoded value is not valid
+ * @see skip_entry()
+ */
+std::size_t index_elements(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        std::vector<std::size_t>& offsets);
+
+/**
+ * @brief retrieves a series of `int` entries from the current position.
+ * @details This operation will advance the buffer iterator to the next of the last retrieved entry.
+ *      This stops retrieving entries if the destination is filled, the buffer is exhausted,
+ *      or the next entry is not `int`.
+ *      This is equivalent to calling read_int() for each entry, but is faster for a large number of entries.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param destination the destination of the retrieved values
+ * @return the number of retrieved entries
+ * @throws value_input_exception if the encoded value is not valid
+ * @see read_int()
+ */
+std::size_t read_ints(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::int64_t> destination);
+
+/**
+ * @brief retrieves a series of `float8` entries from the current position.
+ * @details This operation will advance the buffer iterator to the next of the last retrieved entry.
+ *      This stops retrieving entries if the destination is filled, the buffer is exhausted,
+ *      or the next entry is not `float8`.
+ *      This is equivalent to calling read_float8() for each entry, but is faster for a large number of entries.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param destination the destination of the retrieved values
+ * @return the number of retrieved entries
+ * @throws value_input_exception if the encoded value is not valid
+ * @see read_float8()
+ */
+std::size_t read_float8s(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<double> destination);
+
+/**
+ * @brief retrieves a series of `date` entries from the current position.
+ * @details This operation will advance the buffer iterator to the next of the last retrieved entry.
+ *      This stops retrieving entries if the destination is filled, the buffer is exhausted,
+ *      or the next entry is not `date`.
+ *      This is equivalent to calling read_date() for each entry, but is faster for a large number of entries.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @param destination the destination of the retrieved values
+ * @return the number of retrieved entries
+ * @throws value_input_exception if the encoded value is not valid
+ * @see read_date()
+ */
+std::size_t read_dates(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<datetime::date> destination);
+
+/**
+ * @brief the result of non-throwing operations: the retrieved value, or the reason code of the failure.
+ * @tparam T the value type
+ * @see try_peek_type()
+ */
+template<class T>
+using value_input_result = util::either<value_input_exception::reason_code, T>;
+
+/**
+ * @brief returns the entry type of the iterator position, without throwing any exceptions.
+ * @details this operation does not advance the buffer iterator.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the current entry type
+ * @return reason_code::buffer_underflow if the buffer is empty
+ * @return reason_code::unrecognized_entry_type if the input entry type is not supported
+ * @see peek_type()
+ */
+[[nodiscard]] value_input_result<entry_type> try_peek_type(
+        util::buffer_view::const_iterator position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `int` entry on the current position, without throwing any exceptions.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ *      This is equivalent to the corresponding `read_*()`, but returns the reason code instead of throwing
+ *      an exception on failure, so that it is suitable for validating untrusted inputs in hot paths.
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the retrieved value
+ * @return reason_code::buffer_underflow if the buffer ends before the entry is completed
+ * @return reason_code::inconsistent_entry_type if the entry is not expected type
+ * @return reason_code::unrecognized_entry_type if the entry type is not supported
+ * @return reason_code::value_out_of_range if the encoded value is not valid
+ * @see read_int()
+ */
+[[nodiscard]] value_input_result<std::int64_t> try_read_int(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `float4` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_float4()
+ */
+[[nodiscard]] value_input_result<float> try_read_float4(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `float8` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_float8()
+ */
+[[nodiscard]] value_input_result<double> try_read_float8(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `decimal` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_decimal()
+ */
+[[nodiscard]] value_input_result<decimal::triple> try_read_decimal(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `character` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_character()
+ */
+[[nodiscard]] value_input_result<std::string_view> try_read_character(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `octet` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_octet()
+ */
+[[nodiscard]] value_input_result<std::string_view> try_read_octet(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `bit` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_bit()
+ */
+[[nodiscard]] value_input_result<util::const_bitset_view> try_read_bit(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `date` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_date()
+ */
+[[nodiscard]] value_input_result<datetime::date> try_read_date(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `time_of_day` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_time_of_day()
+ */
+[[nodiscard]] value_input_result<datetime::time_of_day> try_read_time_of_day(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `time_point` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_time_point()
+ */
+[[nodiscard]] value_input_result<datetime::time_point> try_read_time_point(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `datetime_interval` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_datetime_interval()
+ */
+[[nodiscard]] value_input_result<datetime::datetime_interval> try_read_datetime_interval(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `array` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_array_begin()
+ */
+[[nodiscard]] value_input_result<std::size_t> try_read_array_begin(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `row` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_row_begin()
+ */
+[[nodiscard]] value_input_result<std::size_t> try_read_row_begin(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `clob` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_clob()
+ */
+[[nodiscard]] value_input_result<std::string_view> try_read_clob(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief retrieves `blob` entry on the current position, without throwing any exceptions.
+ * @copydetails try_read_int()
+ * @see read_blob()
+ */
+[[nodiscard]] value_input_result<std::string_view> try_read_blob(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end) noexcept;
 
 } // namespace takatori::serializer
@@ -25,6 +25,9 @@ public:
 
         /// @brief value is out of range.
         value_out_of_range,
+
+        /// @brief the entry type is not the expected one.
+        inconsistent_entry_type,
     };
 
     /**
@@ -100,6 +103,7 @@ constexpr std::string_view to_string_view(value_input_exception::reason_code val
         case kind::unrecognized_entry_type: return "unrecognized_entry_type"sv;
         case kind::unsupported_entry_type: return "unsupported_entry_type"sv;
         case kind::value_out_of_range: return "value_out_of_range"sv;
+        case kind::inconsistent_entry_type: return "inconsistent_entry_type"sv;
     }
     std::abort();
 }
@@ -15,6 +15,7 @@
 
 #include <takatori/util/bitset_view.h>
 #include <takatori/util/buffer_view.h>
+#include <takatori/util/sequence_view.h>
 
 namespace takatori::serializer {
 
@@ -120,6 +121,22 @@ bool write_character(
         util::buffer_view::iterator& position,
         util::buffer_view::const_iterator end);
 
+/**
+ * @brief puts the header of `character` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @attention The caller must put the character string contents of just the given size after this operation.
+ * @param size the number of bytes in the contents
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ * @see write_character()
+ */
+bool write_character_header(
+        std::size_t size,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
 /**
  * @brief puts `octet` entry onto the current position.
  * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
@@ -137,6 +154,22 @@ bool write_octet(
         util::buffer_view::iterator& position,
         util::buffer_view::const_iterator end);
 
+/**
+ * @brief puts the header of `octet` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @attention The caller must put the octet string contents of just the given size after this operation.
+ * @param size the number of bytes in the contents
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ * @see write_octet()
+ */
+bool write_octet_header(
+        std::size_t size,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
 /**
  * @brief puts `bit` entry onto the current position.
  * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
@@ -270,6 +303,112 @@ bool write_row_begin(
         util::buffer_view::iterator& position,
         util::buffer_view::const_iterator end);
 
-// FIXME: impl blob, clob
+/**
+ * @brief puts `clob` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @param value the value to write
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ */
+bool write_clob(
+        std::string_view value,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts the header of `clob` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @attention The caller must put the character large object contents of just the given size after this operation.
+ * @param size the number of bytes in the contents
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ * @see write_clob()
+ */
+bool write_clob_header(
+        std::size_t size,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts `blob` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @param value the value to write
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ */
+bool write_blob(
+        std::string_view value,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts the header of `blob` entry onto the current position.
+ * @details This operation will advance the buffer iterator to the next entry, only if it is successfully completed.
+ * @attention The caller must put the binary large object contents of just the given size after this operation.
+ * @param size the number of bytes in the contents
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return true the operation successfully completed
+ * @return false the remaining buffer is too short to write contents
+ * @see write_blob()
+ */
+bool write_blob_header(
+        std::size_t size,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts a series of `int` entries onto the current position.
+ * @details This operation will advance the buffer iterator to the next of the last written entry.
+ *      If the remaining buffer is too short, this writes only the leading entries which fit in the buffer.
+ *      This is equivalent to calling write_int() for each value, but is faster for a large number of values.
+ * @param values the values to write
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the number of written entries
+ * @see write_int()
+ */
+std::size_t write_ints(
+        util::sequence_view<std::int64_t const> values,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts a series of `float8` entries onto the current position.
+ * @details This operation will advance the buffer iterator to the next of the last written entry.
+ *      If the remaining buffer is too short, this writes only the leading entries which fit in the buffer.
+ *      This is equivalent to calling write_float8() for each value, but is faster for a large number of values.
+ * @param values the values to write
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the number of written entries
+ * @see write_float8()
+ */
+std::size_t write_float8s(
+        util::sequence_view<double const> values,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
+
+/**
+ * @brief puts a series of `date` entries onto the current position.
+ * @details This operation will advance the buffer iterator to the next of the last written entry.
+ *      If the remaining buffer is too short, this writes only the leading entries which fit in the buffer.
+ *      This is equivalent to calling write_date() for each value, but is faster for a large number of values.
+ * @param values the values to write
+ * @param position the buffer content iterator
+ * @param end the buffer ending position
+ * @return the number of written entries
+ * @see write_date()
+ */
+std::size_t write_dates(
+        util::sequence_view<datetime::date const> values,
+        util::buffer_view::iterator& position,
+        util::buffer_view::const_iterator end);
 
 } // namespace takatori::serializer
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "value_input.h"
+
+#include <takatori/util/fail.h>
+
+namespace takatori::serializer {
+
+/**
+ * @brief retrieves value entries from a backing reader.
+ * @details This pulls the serialized entries from the backing reader chunk by chunk into a bounded buffer,
+ *      so that callers can decode a large sequence of entries before the tail of them arrives.
+ *      An entry may straddle the chunk boundaries: this pulls the next chunks until the entry is completed.
+ *      Such incomplete entries are detected by the non-throwing `try_read_*()`, so that they never raise exceptions.
+ *
+ *      The buffer capacity is only exceeded if a single entry is larger than it,
+ *      because `character`, `octet`, `bit`, `clob` and `blob` contents are returned as contiguous views.
+ * @attention The views returned from the individual operations refer onto the internal buffer,
+ *      and they will be invalidated on the next operation.
+ *      Please escape the returned value before calling the next operation.
+ * @tparam Reader the backed reader type, should declare `T::read(char* data, size_type size) -> size_type`,
+ *      which fills at most `size` bytes into `data`, and returns the number of filled bytes,
+ *      or `0` if there are no more contents
+ * @tparam Size the size type represents the number of bytes to read
+ * @see value_writer
+ */
+template<class Reader, class Size = std::uint32_t>
+class value_reader {
+public:
+    /// @brief the backed reader type.
+    using reader_type = Reader;
+
+    /// @brief Size the size type represents the number of bytes to read.
+    using size_type = Size;
+
+    /// @brief the default buffer capacity in bytes.
+    static constexpr std::size_t default_capacity = 8192;
+
+    /**
+     * @brief creates a new instance.
+     * @param reader the source reader
+     * @param capacity the buffer capacity in bytes
+     */
+    explicit value_reader(reader_type& reader, std::size_t capacity = default_capacity) :
+        reader_ { std::addressof(reader) },
+        buffer_(std::max(capacity, std::size_t { 1 }))
+    {}
+
+    /**
+     * @brief returns whether or not there are no more entries.
+     * @details This may pull the next chunk from the backing reader.
+     * @return true if both the buffer and the backing reader are exhausted
+     * @return false otherwise
+     */
+    [[nodiscard]] bool eof() {
+        return begin_ == end_ && !fill();
+    }
+
+    /**
+     * @brief returns the entry type of the current position.
+     * @return the current entry type
+     * @throws value_input_exception if there are no more entries
+     * @throws value_input_exception if the input entry type is not supported
+     * @see ::takatori::serializer::peek_type()
+     */
+    [[nodiscard]] entry_type peek_type() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_peek_type(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::peek_type(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_end_of_contents()
+    void read_end_of_contents() {
+        // just a header octet
+        require(1);
+        util::buffer_view::const_iterator iter = buffer_.data() + begin_; // NOLINT
+        ::takatori::serializer::read_end_of_contents(iter, buffer_.data() + end_); // NOLINT
+        begin_ = static_cast<std::size_t>(iter - buffer_.data());
+    }
+
+    /// @copydoc ::takatori::serializer::read_null()
+    void read_null() {
+        // just a header octet
+        require(1);
+        util::buffer_view::const_iterator iter = buffer_.data() + begin_; // NOLINT
+        ::takatori::serializer::read_null(iter, buffer_.data() + end_); // NOLINT
+        begin_ = static_cast<std::size_t>(iter - buffer_.data());
+    }
+
+    /// @copydoc ::takatori::serializer::read_int()
+    std::int64_t read_int() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_int(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_int(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_float4()
+    float read_float4() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_float4(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_float4(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_float8()
+    double read_float8() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_float8(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_float8(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_decimal()
+    decimal::triple read_decimal() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_decimal(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_decimal(iter, end); });
+    }
+
+    /**
+     * @brief retrieves `character` entry on the current position.
+     * @return the retrieved value, which refers onto the internal buffer
+     * @see ::takatori::serializer::read_character()
+     */
+    std::string_view read_character() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_character(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_character(iter, end); });
+    }
+
+    /**
+     * @brief retrieves `octet` entry on the current position.
+     * @return the retrieved value, which refers onto the internal buffer
+     * @see ::takatori::serializer::read_octet()
+     */
+    std::string_view read_octet() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_octet(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_octet(iter, end); });
+    }
+
+    /**
+     * @brief retrieves `bit` entry on the current position.
+     * @return the retrieved value, which refers onto the internal buffer
+     * @see ::takatori::serializer::read_bit()
+     */
+    util::const_bitset_view read_bit() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_bit(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_bit(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_date()
+    datetime::date read_date() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_date(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_date(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_time_of_day()
+    datetime::time_of_day read_time_of_day() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_time_of_day(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_time_of_day(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_time_point()
+    datetime::time_point read_time_point() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_time_point(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_time_point(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_datetime_interval()
+    datetime::datetime_interval read_datetime_interval() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_datetime_interval(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_datetime_interval(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_array_begin()
+    std::size_t read_array_begin() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_array_begin(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_array_begin(iter, end); });
+    }
+
+    /// @copydoc ::takatori::serializer::read_row_begin()
+    std::size_t read_row_begin() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_row_begin(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_row_begin(iter, end); });
+    }
+
+    /**
+     * @brief retrieves `clob` entry on the current position.
+     * @return the retrieved value, which refers onto the internal buffer
+     * @see ::takatori::serializer::read_clob()
+     */
+    std::string_view read_clob() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_clob(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_clob(iter, end); });
+    }
+
+    /**
+     * @brief retrieves `blob` entry on the current position.
+     * @return the retrieved value, which refers onto the internal buffer
+     * @see ::takatori::serializer::read_blob()
+     */
+    std::string_view read_blob() {
+        return apply(
+                [](auto& iter, auto end) { return ::takatori::serializer::try_read_blob(iter, end); },
+                [](auto& iter, auto end) { return ::takatori::serializer::read_blob(iter, end); });
+    }
+
+    /**
+     * @brief returns the number of bytes in the buffer, which are not consumed yet.
+     * @return the number of buffered bytes
+     */
+    [[nodiscard]] std::size_t buffered_size() const noexcept {
+        return end_ - begin_;
+    }
+
+    /**
+     * @brief returns the current buffer capacity.
+     * @return the buffer capacity in bytes
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return buffer_.size();
+    }
+
+private:
+    reader_type* reader_;
+    std::vector<char> buffer_;
+    std::size_t begin_ {};
+    std::size_t end_ {};
+
+    // performs the operation on the buffered bytes, and pulls the next chunk while the entry is not completed
+    template<class TryOperation, class Operation>
+    auto apply(TryOperation&& try_operation, Operation&& operation) {
+        while (true) {
+            util::buffer_view::const_iterator iter = buffer_.data() + begin_; // NOLINT
+            util::buffer_view::const_iterator end = buffer_.data() + end_; // NOLINT
+            auto result = try_operation(iter, end);
+            if (result) {
+                begin_ = static_cast<std::size_t>(iter - buffer_.data());
+                return std::move(*result);
+            }
+            if (result.error() != value_input_exception::reason_code::buffer_underflow || !fill()) {
+                // raises the corresponding exception
+                operation(iter, end);
+                util::fail();
+            }
+        }
+    }
+
+    // pulls the next chunks until the buffer has at least the given number of bytes, or the reader is exhausted
+    void require(std::size_t size) {
+        while (end_ - begin_ < size && fill()) {
+            // continue
+        }
+    }
+
+    // pulls the next chunk from the backing reader, or returns false if it has been exhausted
+    bool fill() {
+        if (begin_ > 0) {
+            // moves the incomplete entry to the head of the buffer
+            std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_); // NOLINT
+            end_ -= begin_;
+            begin_ = 0;
+        }
+        if (end_ == buffer_.size()) {
+            // the current entry is larger than the buffer
+            buffer_.resize(buffer_.size() * 2);
+        }
+        auto read_size = reader_->read(
+                buffer_.data() + end_, // NOLINT
+                static_cast<size_type>(buffer_.size() - end_));
+        if (read_size == 0) {
+            return false;
+        }
+        end_ += static_cast<std::size_t>(read_size);
+        return true;
+    }
+};
+
+} // namespace takatori::serializer
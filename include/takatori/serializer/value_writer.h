@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "value_output.h"
@@ -12,8 +14,14 @@ namespace takatori::serializer {
 
 /**
  * @brief writes value entries into a backing writer.
- * @tparam Writer the backed writer type, should declare `T::write(char const* data, size_type size) -> result_type`
+ * @details Contents of large `character`, `octet`, `clob` and `blob` entries are passed to the backing writer
+ *      directly from the given buffer without copying them, that is, such an entry is written by two `T::write()`
+ *      calls: one is for the entry header, and another is for its contents.
+ *      To batch many small entries into fewer `T::write()` calls, please wrap the backing writer with buffered_writer.
+ * @tparam Writer the backed writer type, should declare `T::write(char const* data, size_type size) -> result_type`,
+ *      where `result_type` is `void` or a type which can be tested as `bool`
  * @tparam Size the size type represents the number of bytes to write
+ * @see buffered_writer
  */
 template<class Writer, class Size = std::uint32_t>
 class value_writer {
@@ -30,6 +38,9 @@ public:
                     std::declval<char const*>(),
                     std::declval<size_type>()));
 
+    /// @brief the minimum number of content bytes to pass them to the backing writer directly.
+    static constexpr std::size_t direct_write_threshold = 1024;
+
     /**
      * @brief creates a new instance.
      * @param writer the destination writer
@@ -124,6 +135,11 @@ public:
      * @param value the value to write
      */
     result_type write_character(std::string_view value) {
+        if (value.size() >= direct_write_threshold) {
+            return write_with_contents(value, [&](auto& iter, auto end) {
+                return ::takatori::serializer::write_character_header(value.size(), iter, end);
+            });
+        }
         auto buf = buffer(value.size() + 10);
         auto *iter = buf.begin();
         auto ret = ::takatori::serializer::write_character(value, iter, buf.end());
@@ -138,6 +154,11 @@ public:
      * @param value the value to write
      */
     result_type write_octet(std::string_view value) {
+        if (value.size() >= direct_write_threshold) {
+            return write_with_contents(value, [&](auto& iter, auto end) {
+                return ::takatori::serializer::write_octet_header(value.size(), iter, end);
+            });
+        }
         auto buf = buffer(value.size() + 10);
         auto *iter = buf.begin();
         auto ret = ::takatori::serializer::write_octet(value, iter, buf.end());
@@ -260,7 +281,68 @@ public:
         return writer_->write(buf.data(), write_size);
     }
 
-    // FIXME: impl blob, clob
+    /**
+     * @brief puts `clob` entry onto the current position.
+     * @param value the value to write
+     */
+    result_type write_clob(std::string_view value) {
+        return write_with_contents(value, [&](auto& iter, auto end) {
+            return ::takatori::serializer::write_clob_header(value.size(), iter, end);
+        });
+    }
+
+    /**
+     * @brief puts the header of `clob` entry onto the current position.
+     * @details This is designed for streaming large objects:
+     *      the caller must put the contents of just the given size by write_contents() after this operation.
+     * @param size the number of bytes in the contents
+     */
+    result_type write_clob_header(std::size_t size) {
+        auto buf = buffer();
+        auto *iter = buf.begin();
+        auto ret = ::takatori::serializer::write_clob_header(size, iter, buf.end());
+        BOOST_ASSERT(ret); // NOLINT
+
+        auto write_size = static_cast<size_type>(std::distance(buf.begin(), iter));
+        return writer_->write(buf.data(), write_size);
+    }
+
+    /**
+     * @brief puts `blob` entry onto the current position.
+     * @param value the value to write
+     */
+    result_type write_blob(std::string_view value) {
+        return write_with_contents(value, [&](auto& iter, auto end) {
+            return ::takatori::serializer::write_blob_header(value.size(), iter, end);
+        });
+    }
+
+    /**
+     * @brief puts the header of `blob` entry onto the current position.
+     * @details This is designed for streaming large objects:
+     *      the caller must put the contents of just the given size by write_contents() after this operation.
+     * @param size the number of bytes in the contents
+     */
+    result_type write_blob_header(std::size_t size) {
+        auto buf = buffer();
+        auto *iter = buf.begin();
+        auto ret = ::takatori::serializer::write_blob_header(size, iter, buf.end());
+        BOOST_ASSERT(ret); // NOLINT
+
+        auto write_size = static_cast<size_type>(std::distance(buf.begin(), iter));
+        return writer_->write(buf.data(), write_size);
+    }
+
+    /**
+     * @brief puts a chunk of entry contents onto the current position.
+     * @details The chunk is passed to the backing writer directly.
+     * @param chunk the contents chunk
+     * @see write_clob_header()
+     * @see write_blob_header()
+     */
+    result_type write_contents(std::string_view chunk) {
+        return writer_->write(chunk.data(), static_cast<size_type>(chunk.size()));
+    }
 
 private:
     std::vector<util::buffer_view::value_type> buffer_;
@@ -272,6 +354,29 @@ private:
         }
         return util::buffer_view { buffer_.data(), buffer_.size() };
     }
+
+    template<class Header>
+    result_type write_with_contents(std::string_view contents, Header&& header) {
+        auto buf = buffer();
+        auto *iter = buf.begin();
+        auto ret = header(iter, buf.end());
+        BOOST_ASSERT(ret); // NOLINT
+
+        auto write_size = static_cast<size_type>(std::distance(buf.begin(), iter));
+        if (contents.empty()) {
+            return writer_->write(buf.data(), write_size);
+        }
+        if constexpr (std::is_void_v<result_type>) { // NOLINT
+            writer_->write(buf.data(), write_size);
+            writer_->write(contents.data(), static_cast<size_type>(contents.size()));
+        } else { // NOLINT
+            auto result = writer_->write(buf.data(), write_size);
+            if (!result) {
+                return result;
+            }
+            return writer_->write(contents.data(), static_cast<size_type>(contents.size()));
+        }
+    }
 };
 
 } // namespace takatori::serializer
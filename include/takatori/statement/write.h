@@ -1,13 +1,16 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 
 #include <takatori/descriptor/relation.h>
 #include <takatori/descriptor/variable.h>
 #include <takatori/scalar/expression.h>
+#include <takatori/scalar/literal_block.h>
 #include <takatori/relation/write_kind.h>
 #include <takatori/tree/tree_fragment_vector.h>
 #include <takatori/util/clone_tag.h>
+#include <takatori/util/optional_ptr.h>
 #include <takatori/util/rvalue_reference_wrapper.h>
 
 #include "statement.h"
@@ -113,12 +116,40 @@ public:
      * @brief returns the tuples to write.
      * @details The individual elements in each tuple must be ordered by columns().
      * @return the value tuples
+     * @attention This does not contain the tuples in block(). To handle all tuples in the same way,
+     *      call materialize_block() before using this.
      */
     [[nodiscard]] tree::tree_fragment_vector<tuple>& tuples() noexcept;
 
     /// @copydoc tuples()
     [[nodiscard]] tree::tree_fragment_vector<tuple> const& tuples() const noexcept;
 
+    /**
+     * @brief returns the columnar block of literals.
+     * @details If this is present, each row of the block represents the individual tuples to write,
+     *      in addition to the tuples().
+     * @return the columnar block
+     * @return empty if this statement has no columnar block
+     * @see materialize_block()
+     */
+    [[nodiscard]] util::optional_ptr<scalar::literal_block const> block() const noexcept;
+
+    /**
+     * @brief sets the columnar block of literals.
+     * @details Copies of this statement share the block instead of copying the individual literals.
+     * @param block the columnar block, its columns must be ordered by columns(); or empty to remove it
+     * @return this
+     * @throws std::invalid_argument if the number of block columns is inconsistent to columns()
+     */
+    write& block(std::shared_ptr<scalar::literal_block const> block);
+
+    /**
+     * @brief expands the columnar block into the tail of tuples(), and then removes the block.
+     * @details This does nothing if block() is absent.
+     * @return this
+     */
+    write& materialize_block();
+
     /**
      * @brief returns whether or not the two elements are equivalent.
      * @param a the first element
@@ -154,6 +185,7 @@ private:
     descriptor::relation destination_;
     std::vector<column> columns_;
     tree::tree_fragment_vector<tuple> tuples_;
+    std::shared_ptr<scalar::literal_block const> block_ {};
 };
 
 } // namespace takatori::statement
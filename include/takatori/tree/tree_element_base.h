@@ -1,11 +1,13 @@
 #pragma once
 
+#include <takatori/util/object_memory.h>
+
 namespace takatori::tree {
 
 /**
  * @brief a generic tree node.
  */
-class tree_element_base {
+class tree_element_base : public util::object_memory_support {
 public:
     /**
      * @brief destroys this object.
@@ -100,6 +100,9 @@ Parent& assign_element(Parent& parent, std::unique_ptr<E, D>& destination, std::
     static_assert(is_tree_fragment_v<E>);
     using traits = tree_fragment_traits<E>;
     static_assert(std::is_convertible_v<Parent*, typename traits::parent_type*>);
+    if (destination) {
+        unbless_element(*destination);
+    }
     destination = bless_element(parent, std::move(source));
     return parent;
 }
@@ -118,6 +121,9 @@ void assign_element_fragment(Parent* parent, std::unique_ptr<E, D>& destination,
     static_assert(is_tree_fragment_v<E>);
     using traits = tree_fragment_traits<E>;
     static_assert(std::is_convertible_v<Parent*, typename traits::parent_type*>);
+    if (destination) {
+        unbless_element(*destination);
+    }
     if (parent != nullptr) {
         destination = bless_element(*parent, std::move(source));
     } else {
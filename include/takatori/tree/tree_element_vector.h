@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iterator>
+
 #include "tree_fragment_traits.h"
 #include "tree_element_util.h"
 
@@ -226,6 +228,7 @@ public:
      * @brief removes all elements in this.
      */
     void clear() noexcept {
+        unbless();
         elements_.clear();
     }
 
@@ -238,6 +241,7 @@ public:
     template<class U, class C = typename util::reference_vector<U>::copier_type>
     std::enable_if_t<std::is_convertible_v<U&, reference>>
     assign(util::reference_vector<U, C> elements) {
+        unbless();
         elements_ = std::move(elements);
         bless();
     }
@@ -248,6 +252,7 @@ public:
      * @return the next position of the erased element
      */
     iterator erase(const_iterator position) noexcept {
+        unbless(elements_[index_of(position)]);
         return elements_.erase(position);
     }
 
@@ -258,6 +263,9 @@ public:
      * @return the next position of the "last"
      */
     iterator erase(const_iterator first, const_iterator last) noexcept {
+        for (auto index = index_of(first), end = index_of(last); index < end; ++index) {
+            unbless(elements_[index]);
+        }
         return elements_.erase(first, last);
     }
 
@@ -266,6 +274,7 @@ public:
      * @warning undefined behavior if this is empty
      */
     void pop_back() noexcept {
+        unbless(elements_.back());
         elements_.pop_back();
     }
 
@@ -535,6 +544,8 @@ public:
      */
     void swap(tree_element_vector& other) noexcept {
         std::swap(elements_, other.elements_);
+        bless();
+        other.bless();
     }
 
 private:
@@ -544,6 +555,10 @@ private:
     void bless(reference element) { bless_element(parent_, element); }
     void unbless(reference element) { unbless_element(element); }
 
+    [[nodiscard]] size_type index_of(const_iterator position) const noexcept {
+        return static_cast<size_type>(std::distance(cbegin(), position));
+    }
+
     void bless() {
         for (value_type& e : elements_) {
             bless(e);
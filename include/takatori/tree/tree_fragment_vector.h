@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iterator>
 #include <type_traits>
 #include <vector>
 
@@ -262,6 +263,7 @@ public:
      * @brief removes all elements in this.
      */
     void clear() noexcept {
+        unbless(elements_);
         elements_.clear();
     }
 
@@ -270,6 +272,7 @@ public:
      * @param list the source elements
      */
     void assign(std::initializer_list<T> list) {
+        unbless(elements_);
         elements_.assign(list);
         bless(elements_);
     }
@@ -279,6 +282,7 @@ public:
      * @param list the source elements
      */
     void assign(util::rvalue_initializer_list<T> list) {
+        unbless(elements_);
         elements_.assign(list.begin(), list.end());
         bless(elements_);
     }
@@ -291,6 +295,7 @@ public:
      */
     template<class Iter>
     void assign(Iter first, Iter last) {
+        unbless(elements_);
         elements_.assign(first, last);
         bless(elements_);
     }
@@ -301,6 +306,7 @@ public:
      * @return the next position of the erased element
      */
     iterator erase(const_iterator position) noexcept {
+        unbless(*to_iterator(position));
         return elements_.erase(position);
     }
 
@@ -311,6 +317,9 @@ public:
      * @return the next position of the "last"
      */
     iterator erase(const_iterator first, const_iterator last) noexcept {
+        for (auto iter = to_iterator(first), end = to_iterator(last); iter != end; ++iter) {
+            unbless(*iter);
+        }
         return elements_.erase(first, last);
     }
 
@@ -319,6 +328,7 @@ public:
      * @warning undefined behavior if this is empty
      */
     void pop_back() noexcept {
+        unbless(elements_.back());
         elements_.pop_back();
     }
 
@@ -525,6 +535,8 @@ public:
      */
     void swap(tree_fragment_vector& other) noexcept {
         std::swap(elements_, other.elements_);
+        bless(elements_);
+        other.bless(other.elements_);
     }
 
 private:
@@ -541,6 +553,10 @@ private:
         traits::set_parent_element(element, nullptr);
     }
 
+    [[nodiscard]] iterator to_iterator(const_iterator position) noexcept {
+        return elements_.begin() + std::distance(elements_.cbegin(), position);
+    }
+
     template<class Iter>
     void bless(Iter first, Iter last) {
         BOOST_ASSERT(first <= last); // NOLINT
@@ -5,13 +5,15 @@
 
 #include "type_kind.h"
 
+#include <takatori/util/object_memory.h>
+
 
 namespace takatori::type {
 
 /**
  * @brief a root model of data types.
  */
-class data {
+class data : public util::object_memory_support {
 public:
     /**
      * @brief destroys this object.
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_set>
+
+#include "data.h"
+
+namespace takatori::type {
+
+/**
+ * @brief a repository which provides canonical instances of types.
+ * @details This returns the same shared instance for the equivalent types,
+ *      so that the types obtained from the same repository can be compared by their addresses,
+ *      and the repeated types only consume memory once.
+ * @note This class is thread-safe.
+ */
+class repository {
+public:
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /**
+     * @brief creates a new empty instance.
+     */
+    repository() = default;
+
+    ~repository() = default;
+    repository(repository const& other) = delete;
+    repository& operator=(repository const& other) = delete;
+    repository(repository&& other) noexcept = delete;
+    repository& operator=(repository&& other) noexcept = delete;
+
+    /**
+     * @brief returns the canonical instance of the given type.
+     * @details If the repository does not have the equivalent type yet, this registers a clone of the given type.
+     * @param type the target type
+     * @return the canonical instance
+     */
+    [[nodiscard]] std::shared_ptr<data const> get(data const& type);
+
+    /// @copydoc get(data const&)
+    [[nodiscard]] std::shared_ptr<data const> get(data&& type);
+
+    /**
+     * @brief returns the canonical instance of the given type.
+     * @details If the repository does not have the equivalent type yet, this registers the given instance itself.
+     * @param type the target type
+     * @return the canonical instance
+     * @return empty if the input is empty
+     */
+    [[nodiscard]] std::shared_ptr<data const> get(std::shared_ptr<data const> type);
+
+    /**
+     * @brief returns the canonical instance of the given type.
+     * @tparam T the type class
+     * @param type the target type
+     * @return the canonical instance
+     */
+    template<
+            class T,
+            class = std::enable_if_t<
+                    std::is_base_of_v<data, std::remove_const_t<std::remove_reference_t<T>>>
+                    && !std::is_same_v<data, std::remove_const_t<std::remove_reference_t<T>>>>>
+    [[nodiscard]] std::shared_ptr<std::remove_reference_t<T> const> get(T&& type) {
+        using result_type = std::remove_const_t<std::remove_reference_t<T>>;
+        auto result = get(static_cast<std::conditional_t<
+                std::is_rvalue_reference_v<T&&> && !std::is_const_v<std::remove_reference_t<T>>,
+                data&&,
+                data const&>>(type));
+        return std::static_pointer_cast<result_type const>(std::move(result));
+    }
+
+    /**
+     * @brief returns the number of registered types.
+     * @return the number of registered types
+     */
+    [[nodiscard]] size_type size() const;
+
+    /**
+     * @brief removes all registered types.
+     * @details The instances which have been already returned are still available.
+     */
+    void clear();
+
+private:
+    struct entry_hash {
+        std::size_t operator()(std::shared_ptr<data const> const& type) const noexcept {
+            return std::hash<data> {}(*type);
+        }
+    };
+
+    struct entry_equal {
+        bool operator()(std::shared_ptr<data const> const& a, std::shared_ptr<data const> const& b) const noexcept {
+            return *a == *b;
+        }
+    };
+
+    std::unordered_set<std::shared_ptr<data const>, entry_hash, entry_equal> entries_ {};
+    mutable std::mutex mutex_ {};
+
+    template<class Factory>
+    std::shared_ptr<data const> find_or_insert(data const& type, Factory&& factory);
+};
+
+} // namespace takatori::type
@@ -6,6 +6,7 @@
 #include <cstddef>
 
 #include "details/basic_bit_pointer.h"
+#include "details/bit_operations.h"
 #include "details/basic_bit_reference.h"
 
 namespace takatori::util {
@@ -225,6 +226,25 @@ template<class U, class V>
     if (left.size() != right.size()) {
         return false;
     }
+    if constexpr (sizeof(U) == sizeof(V)) { // NOLINT(bugprone-sizeof-expression)
+        // compares whole blocks, and then only the available bits in the last block
+        using block_type = std::make_unsigned_t<std::remove_cv_t<U>>;
+        constexpr std::size_t units = basic_bitset_view<U>::block_units;
+        auto whole_blocks = left.size() / units;
+        for (std::size_t i = 0; i < whole_blocks; ++i) {
+            if (static_cast<block_type>(left.block_data()[i]) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    != static_cast<block_type>(right.block_data()[i])) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                return false;
+            }
+        }
+        if (auto rest = left.size() % units; rest != 0) {
+            auto mask = details::lower_mask<block_type>(rest);
+            auto a = static_cast<block_type>(left.block_data()[whole_blocks]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto b = static_cast<block_type>(right.block_data()[whole_blocks]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return ((a ^ b) & mask) == 0;
+        }
+        return true;
+    }
     for (std::size_t i = 0, n = left.size(); i < n; ++i) {
         if (left[i] != right[i]) {
             return false;
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "detect.h"
+#include "object_memory.h"
 #include "pointer_traits.h"
 #include "rvalue_ptr.h"
 #include "rvalue_reference_wrapper.h"
@@ -139,7 +140,7 @@ template<class T>
 template<class T>
 [[nodiscard]] inline auto clone_shared(T&& object) {
     auto* raw = clone(std::forward<T>(object));
-    return std::shared_ptr<std::remove_pointer_t<decltype(raw)>>(raw);
+    return share_object(raw);
 }
 
 /**
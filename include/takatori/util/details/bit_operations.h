@@ -0,0 +1,73 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace takatori::util::details {
+
+/**
+ * @brief returns the number of `1` bits in the given block.
+ * @tparam T the block type
+ * @param block the target block
+ * @return the number of `1` bits
+ */
+template<class T>
+[[nodiscard]] constexpr std::size_t popcount(T block) noexcept {
+    static_assert(std::is_integral_v<T>);
+    using unsigned_type = std::make_unsigned_t<T>;
+    static_assert(std::numeric_limits<unsigned_type>::digits <= std::numeric_limits<unsigned long long>::digits);
+    return static_cast<std::size_t>(__builtin_popcountll(static_cast<unsigned_type>(block)));
+}
+
+/**
+ * @brief returns the position of the lowest `1` bit in the given block.
+ * @tparam T the block type
+ * @param block the target block
+ * @return the bit position (0-origin)
+ * @pre `block != 0`
+ * @attention undefined behavior if the block is `0`
+ */
+template<class T>
+[[nodiscard]] constexpr std::size_t count_trailing_zeros(T block) noexcept {
+    static_assert(std::is_integral_v<T>);
+    using unsigned_type = std::make_unsigned_t<T>;
+    static_assert(std::numeric_limits<unsigned_type>::digits <= std::numeric_limits<unsigned long long>::digits);
+    return static_cast<std::size_t>(__builtin_ctzll(static_cast<unsigned_type>(block)));
+}
+
+/**
+ * @brief returns the number of `0` bits above the highest `1` bit in the given block.
+ * @tparam T the block type
+ * @param block the target block
+ * @return the number of leading `0` bits
+ * @pre `block != 0`
+ * @attention undefined behavior if the block is `0`
+ */
+template<class T>
+[[nodiscard]] constexpr std::size_t count_leading_zeros(T block) noexcept {
+    static_assert(std::is_integral_v<T>);
+    using unsigned_type = std::make_unsigned_t<T>;
+    constexpr auto digits = std::numeric_limits<unsigned_type>::digits;
+    constexpr auto digits_ll = std::numeric_limits<unsigned long long>::digits;
+    static_assert(digits <= digits_ll);
+    return static_cast<std::size_t>(__builtin_clzll(static_cast<unsigned_type>(block)) - (digits_ll - digits));
+}
+
+/**
+ * @brief returns a block whose lower `bits` bits are `1`.
+ * @tparam T the block type
+ * @param bits the number of `1` bits, must be less than or equal to the number of bits in the block
+ * @return the mask
+ */
+template<class T>
+[[nodiscard]] constexpr T lower_mask(std::size_t bits) noexcept {
+    static_assert(std::is_unsigned_v<T>);
+    if (bits >= static_cast<std::size_t>(std::numeric_limits<T>::digits)) {
+        return static_cast<T>(~T {});
+    }
+    return static_cast<T>((T { 1 } << bits) - 1U);
+}
+
+} // namespace takatori::util::details
@@ -0,0 +1,487 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "basic_bitset_view.h"
+#include "details/bit_operations.h"
+
+namespace takatori::util {
+
+/**
+ * @brief a growable bitset, which is designed for sets of dense indices, like column or variable sets.
+ * @details The bits beyond size() are considered as `0`,
+ *      so that the set operations accept the bitsets with different sizes.
+ *      The set operations work on the individual blocks, instead of the individual bits.
+ */
+class dynamic_bitset {
+public:
+    /// @brief the size type.
+    using size_type = std::size_t;
+
+    /// @brief the bit block type.
+    using block_type = std::uint64_t;
+
+    /// @brief the view type of this bitset.
+    using view_type = basic_bitset_view<block_type const>;
+
+    /// @brief the number of available bits in block.
+    static constexpr size_type nbits_in_block = std::numeric_limits<block_type>::digits;
+
+    /// @brief represents "no such position."
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    /**
+     * @brief creates a new empty instance.
+     */
+    dynamic_bitset() = default;
+
+    /**
+     * @brief creates a new instance which all entries are 0.
+     * @param size the number of available bits
+     */
+    explicit dynamic_bitset(size_type size)
+        : blocks_(to_block_size(size))
+        , size_(size)
+    {}
+
+    /**
+     * @brief creates a new instance from the packed bit sequence.
+     * @tparam T the block type of the source
+     * @param bits the source bit sequence
+     */
+    template<class T>
+    explicit dynamic_bitset(basic_bitset_view<T> bits)
+        : dynamic_bitset(bits.size())
+    {
+        using source_block_type = std::make_unsigned_t<std::remove_cv_t<T>>;
+        constexpr size_type source_units = basic_bitset_view<T>::block_units;
+        static_assert(nbits_in_block % source_units == 0);
+        for (size_type i = 0, n = bits.block_size(); i < n; ++i) {
+            auto position = i * source_units;
+            auto block = static_cast<source_block_type>(bits.block_data()[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            blocks_[block_offset(position)] |= static_cast<block_type>(block) << bit_offset(position);
+        }
+        trim();
+    }
+
+    /**
+     * @brief returns the number of available bits.
+     * @return the number of available bits
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief returns whether or not this bitset capacity is empty.
+     * @return true if `size() == 0`
+     * @return false if `size() > 0`
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief changes the number of available bits.
+     * @details The extended bits are `0`, and the truncated bits are discarded.
+     * @param size the number of available bits
+     */
+    void resize(size_type size) {
+        blocks_.resize(to_block_size(size));
+        size_ = size;
+        trim();
+    }
+
+    /**
+     * @brief returns the view of this bitset.
+     * @return the view, which is available until this bitset is modified
+     */
+    [[nodiscard]] view_type view() const noexcept {
+        return view_type { blocks_.data(), size_ };
+    }
+
+    /**
+     * @brief returns the number of blocks.
+     * @return the number of blocks
+     */
+    [[nodiscard]] size_type block_size() const noexcept {
+        return blocks_.size();
+    }
+
+    /**
+     * @brief returns the specified bit.
+     * @param position the bit position (0-origin)
+     * @return true if the target bit is `1`
+     * @return false if the target bit is `0`, or it is out of range
+     */
+    [[nodiscard]] bool get(size_type position) const noexcept {
+        if (position >= size_) {
+            return false;
+        }
+        return (blocks_[block_offset(position)] & bit_mask(position)) != 0;
+    }
+
+    /// @copydoc get()
+    [[nodiscard]] bool test(size_type position) const noexcept {
+        return get(position);
+    }
+
+    /// @copydoc get()
+    [[nodiscard]] bool operator[](size_type position) const noexcept {
+        return get(position);
+    }
+
+    /**
+     * @brief sets the target bit.
+     * @details This extends the size if the position is out of range, and the value is `1`.
+     * @param position the bit position (0-origin)
+     * @param value the value to set
+     * @return this
+     */
+    dynamic_bitset& set(size_type position, bool value = true) {
+        if (position >= size_) {
+            if (!value) {
+                return *this;
+            }
+            resize(position + 1);
+        }
+        auto&& block = blocks_[block_offset(position)];
+        if (value) {
+            block |= bit_mask(position);
+        } else {
+            block &= ~bit_mask(position);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief sets the target bit to `0`.
+     * @param position the bit position (0-origin)
+     * @return this
+     */
+    dynamic_bitset& reset(size_type position) {
+        return set(position, false);
+    }
+
+    /**
+     * @brief sets all bits to `0`.
+     * @return this
+     */
+    dynamic_bitset& reset() noexcept {
+        std::fill(blocks_.begin(), blocks_.end(), block_type {});
+        return *this;
+    }
+
+    /**
+     * @brief returns the number of set bits.
+     * @return the number of set bits.
+     */
+    [[nodiscard]] size_type count() const noexcept {
+        size_type result = 0;
+        for (auto block : blocks_) {
+            result += details::popcount(block);
+        }
+        return result;
+    }
+
+    /**
+     * @brief returns whether or not there is `1` in this set.
+     * @return true if there is one or more `1` in this
+     * @return false otherwise
+     */
+    [[nodiscard]] bool any() const noexcept {
+        return std::any_of(blocks_.begin(), blocks_.end(), [](block_type block) { return block != 0; });
+    }
+
+    /**
+     * @brief returns whether or not the all bits are `0`.
+     * @return true if the all bits are `0`, or there are no available bits
+     * @return false otherwise
+     */
+    [[nodiscard]] bool none() const noexcept {
+        return !any();
+    }
+
+    /**
+     * @brief returns the position of the first `1`.
+     * @return the left-most `1` position (0-origin)
+     * @return npos if there are no `1` in this
+     */
+    [[nodiscard]] size_type find_first() const noexcept {
+        return find(0);
+    }
+
+    /**
+     * @brief returns the position of the next `1`.
+     * @param position the exclusive starting position (0-origin)
+     * @return the left-most `1` position from the starting position (0-origin)
+     * @return npos if there are no `1` after the starting position
+     */
+    [[nodiscard]] size_type find_next(size_type position) const noexcept {
+        if (position == npos) {
+            return npos;
+        }
+        return find(position + 1);
+    }
+
+    /**
+     * @brief returns the position of the next `1`.
+     * @param start the inclusive starting position (0-origin)
+     * @return the left-most `1` position from the starting position (0-origin)
+     * @return npos if there are no `1` after the starting position
+     */
+    [[nodiscard]] size_type find(size_type start = 0) const noexcept {
+        if (start >= size_) {
+            return npos;
+        }
+        auto index = block_offset(start);
+        auto block = blocks_[index] & ~details::lower_mask<block_type>(bit_offset(start));
+        while (block == 0) {
+            if (++index >= blocks_.size()) {
+                return npos;
+            }
+            block = blocks_[index];
+        }
+        return index * nbits_in_block + details::count_trailing_zeros(block);
+    }
+
+    /**
+     * @brief returns whether or not this is subset of the target one.
+     * @param other the target
+     * @return true if this is subset of the target one
+     * @return false otherwise
+     */
+    [[nodiscard]] bool is_subset_of(dynamic_bitset const& other) const noexcept {
+        auto common = std::min(blocks_.size(), other.blocks_.size());
+        block_type rest {};
+        for (size_type i = 0; i < common; ++i) {
+            rest |= blocks_[i] & ~other.blocks_[i];
+        }
+        for (size_type i = common, n = blocks_.size(); i < n; ++i) {
+            rest |= blocks_[i];
+        }
+        return rest == 0;
+    }
+
+    /**
+     * @brief return whether or not this and the given one have any `1` bit in the same position.
+     * @param other the target
+     * @return true if any bit is `1` both this and target
+     * @return false otherwise
+     */
+    [[nodiscard]] bool intersects(dynamic_bitset const& other) const noexcept {
+        auto common = std::min(blocks_.size(), other.blocks_.size());
+        for (size_type i = 0; i < common; ++i) {
+            if ((blocks_[i] & other.blocks_[i]) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief sets bits to `1` which is set to `1` in the given one.
+     * @details This extends the size to the given one if it is larger.
+     * @param other the target bit set
+     * @return this
+     */
+    dynamic_bitset& operator|=(dynamic_bitset const& other) {
+        reserve_for(other);
+        auto* dst = blocks_.data();
+        auto const* src = other.blocks_.data();
+        for (size_type i = 0, n = other.blocks_.size(); i < n; ++i) {
+            dst[i] |= src[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return *this;
+    }
+
+    /**
+     * @brief sets bits to `0` which is set to `0` in the given one.
+     * @param other the target bit set
+     * @return this
+     */
+    dynamic_bitset& operator&=(dynamic_bitset const& other) noexcept {
+        auto common = std::min(blocks_.size(), other.blocks_.size());
+        auto* dst = blocks_.data();
+        auto const* src = other.blocks_.data();
+        for (size_type i = 0; i < common; ++i) {
+            dst[i] &= src[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        std::fill(blocks_.begin() + static_cast<std::ptrdiff_t>(common), blocks_.end(), block_type {});
+        return *this;
+    }
+
+    /**
+     * @brief sets bits to `0` which is set to `1` in the given one.
+     * @param other the target bit set
+     * @return this
+     */
+    dynamic_bitset& operator-=(dynamic_bitset const& other) noexcept {
+        auto common = std::min(blocks_.size(), other.blocks_.size());
+        auto* dst = blocks_.data();
+        auto const* src = other.blocks_.data();
+        for (size_type i = 0; i < common; ++i) {
+            dst[i] &= ~src[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return *this;
+    }
+
+    /**
+     * @brief flips bits which is set to `1` in the given one.
+     * @details This extends the size to the given one if it is larger.
+     * @param other the target bit set
+     * @return this
+     */
+    dynamic_bitset& operator^=(dynamic_bitset const& other) {
+        reserve_for(other);
+        auto* dst = blocks_.data();
+        auto const* src = other.blocks_.data();
+        for (size_type i = 0, n = other.blocks_.size(); i < n; ++i) {
+            dst[i] ^= src[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return *this;
+    }
+
+    /**
+     * @brief returns whether or not the both contain the same positions of `1`.
+     * @details This ignores the difference of their sizes.
+     * @param a the first element
+     * @param b the second element
+     * @return true if the both are equivalent
+     * @return false otherwise
+     */
+    [[nodiscard]] friend bool operator==(dynamic_bitset const& a, dynamic_bitset const& b) noexcept {
+        auto const& shorter = a.blocks_.size() <= b.blocks_.size() ? a : b;
+        auto const& longer = a.blocks_.size() <= b.blocks_.size() ? b : a;
+        auto common = shorter.blocks_.size();
+        if (!std::equal(shorter.blocks_.begin(), shorter.blocks_.end(), longer.blocks_.begin())) {
+            return false;
+        }
+        return std::all_of(
+                longer.blocks_.begin() + static_cast<std::ptrdiff_t>(common),
+                longer.blocks_.end(),
+                [](block_type block) { return block == 0; });
+    }
+
+    /**
+     * @brief returns whether or not the both contain the different positions of `1`.
+     * @details This ignores the difference of their sizes.
+     * @param a the first element
+     * @param b the second element
+     * @return true if the both are different
+     * @return false otherwise
+     */
+    [[nodiscard]] friend bool operator!=(dynamic_bitset const& a, dynamic_bitset const& b) noexcept {
+        return !(a == b);
+    }
+
+    /**
+     * @brief appends string representation of the given value.
+     * @param out the output stream
+     * @param value the target value
+     * @return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& out, dynamic_bitset const& value) {
+        out << '{';
+        bool cont = false;
+        for (auto i = value.find_first(); i != npos; i = value.find_next(i)) {
+            if (cont) {
+                out << ", ";
+            }
+            cont = true;
+            out << i;
+        }
+        out << '}';
+        return out;
+    }
+
+private:
+    std::vector<block_type> blocks_ {};
+    size_type size_ {};
+
+    void reserve_for(dynamic_bitset const& other) {
+        if (size_ < other.size_) {
+            resize(other.size_);
+        }
+    }
+
+    // clears the unused bits in the last block
+    void trim() noexcept {
+        if (auto rest = bit_offset(size_); rest != 0) {
+            blocks_.back() &= details::lower_mask<block_type>(rest);
+        }
+    }
+
+    [[nodiscard]] static constexpr size_type to_block_size(size_type size) noexcept {
+        return (size + nbits_in_block - 1) / nbits_in_block;
+    }
+
+    [[nodiscard]] static constexpr size_type block_offset(size_type position) noexcept {
+        return position / nbits_in_block;
+    }
+
+    [[nodiscard]] static constexpr size_type bit_offset(size_type position) noexcept {
+        return position % nbits_in_block;
+    }
+
+    [[nodiscard]] static constexpr block_type bit_mask(size_type position) noexcept {
+        return block_type { 1 } << bit_offset(position);
+    }
+};
+
+/**
+ * @brief returns the intersection of the bitset pair.
+ * @param a the first element
+ * @param b the second element
+ * @return the intersection
+ */
+inline dynamic_bitset operator&(dynamic_bitset const& a, dynamic_bitset const& b) {
+    auto r = a;
+    r &= b;
+    return r;
+}
+
+/**
+ * @brief returns the union of the bitset pair.
+ * @param a the first element
+ * @param b the second element
+ * @return the union
+ */
+inline dynamic_bitset operator|(dynamic_bitset const& a, dynamic_bitset const& b) {
+    auto r = a;
+    r |= b;
+    return r;
+}
+
+/**
+ * @brief returns the difference of the bitset pair.
+ * @param a the first element
+ * @param b the second element
+ * @return the difference
+ */
+inline dynamic_bitset operator-(dynamic_bitset const& a, dynamic_bitset const& b) {
+    auto r = a;
+    r -= b;
+    return r;
+}
+
+/**
+ * @brief returns the symmetric difference of the bitset pair.
+ * @param a the first element
+ * @param b the second element
+ * @return the symmetric difference
+ */
+inline dynamic_bitset operator^(dynamic_bitset const& a, dynamic_bitset const& b) {
+    auto r = a;
+    r ^= b;
+    return r;
+}
+
+} // namespace takatori::util
@@ -3,9 +3,12 @@
 #include <ostream>
 #include <stdexcept>
 
+#include <cstddef>
+
 #include <boost/exception/enable_error_info.hpp>
 
 #include <takatori/util/stacktrace.h>
+#include <takatori/util/stacktrace_policy.h>
 
 // FIXME: move to common core module
 namespace takatori::util {
@@ -13,7 +16,7 @@ namespace takatori::util {
 /// @cond IMPL_DEFS
 namespace impl {
 
-void attach_trace(::boost::exception& exception, ::boost::stacktrace::stacktrace&& trace = {});
+void attach_trace(::boost::exception& exception);
 
 } // namespace impl
 /// @endcond
@@ -22,10 +25,12 @@ void attach_trace(::boost::exception& exception, ::boost::stacktrace::stacktrace
  * @brief throws the given exception.
  * @details this may attach stacktrace information to the given exception if it is enabled.
  *      Developers can obtain it by find_trace() in the corresponded catch block.
+ *      Whether or not the stacktrace is captured depends on the current stacktrace_policy.
  * @tparam T the exception type
  * @param exception the exception to throw
  * @see find_trace()
  * @see print_trace()
+ * @see set_stacktrace_policy()
  */
 template<class T>
 [[noreturn]] void throw_exception(T const& exception) {
@@ -46,10 +51,41 @@ template<class T>
 /**
  * @brief appends stacktrace information into the given output stream.
  * @details This will do nothing if the given exception has no stacktrace information.
+ *      The frame symbols are resolved here, unless the stacktrace was captured under
+ *      stacktrace_policy::raw_addresses, in which case only the frame addresses are printed.
  * @param out the destination output stream
  * @param exception the source exception
  * @see throw_exception()
  */
 void print_trace(std::ostream& out, std::exception const& exception);
 
+/**
+ * @brief changes how throw_exception() captures stacktrace information.
+ * @details The default policy is stacktrace_policy::always.
+ *      This can be changed at any time from any threads, and affects the subsequent throw_exception() calls.
+ * @param policy the new policy
+ * @see set_stacktrace_sampling_interval()
+ */
+void set_stacktrace_policy(stacktrace_policy policy) noexcept;
+
+/**
+ * @brief returns the current stacktrace policy.
+ * @return the current policy
+ */
+[[nodiscard]] stacktrace_policy get_stacktrace_policy() noexcept;
+
+/**
+ * @brief changes the sampling interval of stacktrace_policy::sampled.
+ * @details If the interval is `N`, throw_exception() captures stacktrace information once in every `N` calls.
+ *      The default interval is `100`, and `0` is treated as `1`.
+ * @param interval the number of throw_exception() calls per stacktrace capture
+ */
+void set_stacktrace_sampling_interval(std::size_t interval) noexcept;
+
+/**
+ * @brief returns the current sampling interval of stacktrace_policy::sampled.
+ * @return the current sampling interval
+ */
+[[nodiscard]] std::size_t get_stacktrace_sampling_interval() noexcept;
+
 } // namespace takatori::util
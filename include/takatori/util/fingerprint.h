@@ -0,0 +1,211 @@
+#pragma once
+
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace takatori::util {
+
+/**
+ * @brief a 128-bit fingerprint of structured objects.
+ * @details The equivalent objects always have the same fingerprint, and the different objects have the different
+ *      fingerprints with very high probability.
+ * @note The fingerprints are only stable in the current process,
+ *      because they may depend on the hash code of the individual elements.
+ * @see fingerprint_builder
+ */
+class fingerprint {
+public:
+    /**
+     * @brief creates a new instance which represents zero.
+     */
+    constexpr fingerprint() noexcept = default;
+
+    /**
+     * @brief creates a new instance.
+     * @param high the higher 64-bit
+     * @param low the lower 64-bit
+     */
+    constexpr fingerprint(std::uint64_t high, std::uint64_t low) noexcept :
+        high_ { high },
+        low_ { low }
+    {}
+
+    /**
+     * @brief returns the higher 64-bit of this fingerprint.
+     * @return the higher 64-bit
+     */
+    [[nodiscard]] constexpr std::uint64_t high() const noexcept {
+        return high_;
+    }
+
+    /**
+     * @brief returns the lower 64-bit of this fingerprint.
+     * @return the lower 64-bit
+     */
+    [[nodiscard]] constexpr std::uint64_t low() const noexcept {
+        return low_;
+    }
+
+private:
+    std::uint64_t high_ {};
+    std::uint64_t low_ {};
+};
+
+/**
+ * @brief returns whether or not the two fingerprints are equivalent.
+ * @param a the first fingerprint
+ * @param b the second fingerprint
+ * @return true if a == b
+ * @return false otherwise
+ */
+inline constexpr bool operator==(fingerprint a, fingerprint b) noexcept {
+    return a.high() == b.high() && a.low() == b.low();
+}
+
+/**
+ * @brief returns whether or not the two fingerprints are different.
+ * @param a the first fingerprint
+ * @param b the second fingerprint
+ * @return true if a != b
+ * @return false otherwise
+ */
+inline constexpr bool operator!=(fingerprint a, fingerprint b) noexcept {
+    return !(a == b);
+}
+
+/**
+ * @brief compares the two fingerprints.
+ * @details This is a total order, but it is not meaningful except for arranging fingerprints deterministically.
+ * @param a the first fingerprint
+ * @param b the second fingerprint
+ * @return true if a < b
+ * @return false otherwise
+ */
+inline constexpr bool operator<(fingerprint a, fingerprint b) noexcept {
+    return a.high() < b.high() || (a.high() == b.high() && a.low() < b.low());
+}
+
+/**
+ * @brief appends string representation of the given value.
+ * @param out the target output
+ * @param value the target value
+ * @return the output
+ */
+inline std::ostream& operator<<(std::ostream& out, fingerprint value) {
+    auto flags = out.flags();
+    auto fill = out.fill();
+    out << std::hex << std::setfill('0')
+        << std::setw(16) << value.high()
+        << std::setw(16) << value.low();
+    out.fill(fill);
+    out.flags(flags);
+    return out;
+}
+
+/**
+ * @brief builds a fingerprint from a sequence of values.
+ * @details The result depends on the order of the added values.
+ */
+class fingerprint_builder {
+public:
+    /**
+     * @brief creates a new instance.
+     */
+    constexpr fingerprint_builder() noexcept = default;
+
+    /**
+     * @brief adds a value.
+     * @param value the value
+     * @return this
+     */
+    constexpr fingerprint_builder& add(std::uint64_t value) noexcept {
+        high_ = rotate(high_ ^ value, 31) * prime_high;
+        low_ = rotate(low_ + value * prime_low, 27) * prime_high + prime_low;
+        ++count_;
+        return *this;
+    }
+
+    /**
+     * @brief adds a fingerprint.
+     * @param value the fingerprint
+     * @return this
+     */
+    constexpr fingerprint_builder& add(fingerprint value) noexcept {
+        add(value.high());
+        add(value.low());
+        return *this;
+    }
+
+    /**
+     * @brief adds a sequence of characters.
+     * @param value the characters
+     * @return this
+     */
+    constexpr fingerprint_builder& add(std::string_view value) noexcept {
+        std::uint64_t word = 0;
+        std::size_t index = 0;
+        for (char c : value) {
+            word = (word << 8U) | static_cast<unsigned char>(c);
+            if (++index % sizeof(word) == 0) {
+                add(word);
+                word = 0;
+            }
+        }
+        add(word);
+        add(static_cast<std::uint64_t>(value.size()));
+        return *this;
+    }
+
+    /**
+     * @brief returns the fingerprint of the added values.
+     * @return the built fingerprint
+     */
+    [[nodiscard]] constexpr fingerprint build() const noexcept {
+        auto high = finalize(high_ ^ count_);
+        auto low = finalize(low_ + high);
+        return { high, low };
+    }
+
+private:
+    static constexpr std::uint64_t prime_high = 0x9e3779b97f4a7c15ULL;
+    static constexpr std::uint64_t prime_low = 0xc2b2ae3d27d4eb4fULL;
+
+    std::uint64_t high_ { 0x243f6a8885a308d3ULL };
+    std::uint64_t low_ { 0x13198a2e03707344ULL };
+    std::uint64_t count_ {};
+
+    static constexpr std::uint64_t rotate(std::uint64_t value, unsigned int bits) noexcept {
+        return (value << bits) | (value >> (64U - bits));
+    }
+
+    static constexpr std::uint64_t finalize(std::uint64_t value) noexcept {
+        value ^= value >> 33U;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33U;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33U;
+        return value;
+    }
+};
+
+} // namespace takatori::util
+
+/**
+ * @brief std::hash specialization for takatori::util::fingerprint.
+ */
+template<>
+struct std::hash<takatori::util::fingerprint> {
+    /**
+     * @brief compute hash of the given object.
+     * @param value the target object
+     * @return computed hash code
+     */
+    constexpr std::size_t operator()(takatori::util::fingerprint value) const noexcept {
+        return static_cast<std::size_t>(value.high() ^ value.low());
+    }
+};
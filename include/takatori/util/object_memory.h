@@ -0,0 +1,162 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include <cstddef>
+
+namespace takatori::util {
+
+/**
+ * @brief returns the memory resource for allocating objects on the current thread.
+ * @return the current memory resource
+ * @return nullptr if the objects are allocated by the global allocation functions
+ * @see object_memory_scope
+ */
+[[nodiscard]] std::pmr::memory_resource* object_memory_resource() noexcept;
+
+/**
+ * @brief changes the memory resource for allocating objects on the current thread while this object is alive.
+ * @details This affects objects which inherit object_memory_support, including IR elements created via
+ *      `clone()`, graph::graph::emplace(), or rvalue_ptr conversions, and the shared objects created via
+ *      clone_shared() or make_shared_object().
+ *
+ *      This is an opt-in feature: it only takes effect if the library was built with `ENABLE_PMR`
+ *      (which defines `ENABLE_OBJECT_CREATOR_PMR`). Otherwise, object_memory_support is an empty class and the
+ *      objects are always allocated by the global allocation functions, so that they do not pay any extra cost.
+ *
+ *      Each object remembers its origin memory resource, so that it is released to the same resource
+ *      even if the object was destroyed outside of the scope, or on the another thread.
+ *      Note that, the memory resource must be alive until all objects allocated from it are destroyed.
+ *
+ *      The scope is bound to the current thread. To allocate objects on the other threads from the same
+ *      resource, create another scope in each thread with object_memory_resource() of the original thread.
+ *
+ *      For example, a std::pmr::monotonic_buffer_resource can be used for short-lived IR fragments:
+ *      their deallocations become no-op, and their storage is released at once with the resource.
+ *      Releasing the resource does not call the destructors of the objects. It is safe to abandon the
+ *      objects without destroying them (e.g. by `std::unique_ptr::release()`) only if they do not own any
+ *      resources outside of the memory resource: shared descriptors, or members which use the global allocator
+ *      like long `std::string`, are leaked in that case.
+ * @attention The scopes must be nested: destroying them in a different order from construction is undefined behavior.
+ */
+class object_memory_scope {
+public:
+    /**
+     * @brief creates a new instance.
+     * @param resource the memory resource, or nullptr to use the global allocation functions
+     */
+    explicit object_memory_scope(std::pmr::memory_resource* resource) noexcept;
+
+    /**
+     * @brief restores the previous memory resource.
+     */
+    ~object_memory_scope();
+
+    object_memory_scope(object_memory_scope const&) = delete;
+    object_memory_scope& operator=(object_memory_scope const&) = delete;
+    object_memory_scope(object_memory_scope&&) noexcept = delete;
+    object_memory_scope& operator=(object_memory_scope&&) noexcept = delete;
+
+private:
+    std::pmr::memory_resource* previous_;
+};
+
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+
+/**
+ * @brief a mix-in which enables allocating objects from object_memory_resource().
+ * @details The derived classes are allocated from the memory resource of the current object_memory_scope
+ *      when they are created by `new` expressions.
+ *      The derived class must have a virtual destructor if it is deleted via a pointer to its base class.
+ */
+class object_memory_support {
+public:
+    /**
+     * @brief allocates a new object from the current memory resource.
+     * @param size the object size in bytes
+     * @return the allocated storage
+     * @throws std::bad_alloc if allocation was failed
+     */
+    [[nodiscard]] static void* operator new(std::size_t size);
+
+    /**
+     * @brief releases the object into its origin memory resource.
+     * @param pointer the object storage, which must be allocated by operator new(std::size_t)
+     */
+    static void operator delete(void* pointer) noexcept;
+
+    /**
+     * @brief just returns the given storage.
+     * @param size the object size in bytes
+     * @param storage the object storage
+     * @return the given storage
+     */
+    [[nodiscard]] static void* operator new(std::size_t size, void* storage) noexcept {
+        (void) size;
+        return storage;
+    }
+
+    /**
+     * @brief does nothing.
+     * @param pointer the object storage
+     * @param storage the object storage
+     */
+    static void operator delete(void* pointer, void* storage) noexcept {
+        (void) pointer;
+        (void) storage;
+    }
+};
+
+#else // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+/**
+ * @brief a mix-in which enables allocating objects from object_memory_resource().
+ * @details This is an empty class, because the library was built without `ENABLE_PMR`.
+ */
+class object_memory_support {};
+
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+/**
+ * @brief creates a new shared object.
+ * @details If the object memory is enabled and there is the current memory resource, this creates the object
+ *      via `std::allocate_shared()` with the resource, so that both the object and its control block are
+ *      allocated from the resource. Otherwise, this is same as `std::make_shared()`.
+ * @tparam T the object type
+ * @tparam Args the constructor parameter types
+ * @param args the constructor arguments
+ * @return the created object
+ * @see object_memory_scope
+ */
+template<class T, class... Args>
+[[nodiscard]] std::shared_ptr<T> make_shared_object(Args&&... args) {
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+    if (auto* resource = object_memory_resource(); resource != nullptr) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T> { resource }, std::forward<Args>(args)...);
+    }
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief wraps the given object into std::shared_ptr.
+ * @details If the object memory is enabled and there is the current memory resource, the control block is
+ *      allocated from the resource. Otherwise, this is same as the constructor of `std::shared_ptr`.
+ * @tparam T the object type
+ * @param object the object to share, must be created by `new` expression
+ * @return the shared object
+ * @see object_memory_scope
+ */
+template<class T>
+[[nodiscard]] std::shared_ptr<T> share_object(T* object) {
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+    if (auto* resource = object_memory_resource(); resource != nullptr && object != nullptr) {
+        return std::shared_ptr<T>(object, std::default_delete<T> {}, std::pmr::polymorphic_allocator<T> { resource });
+    }
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+    return std::shared_ptr<T>(object);
+}
+
+} // namespace takatori::util
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdlib>
+
+#include <ostream>
+#include <string_view>
+
+// FIXME: move to common core module
+namespace takatori::util {
+
+/**
+ * @brief represents how throw_exception() captures stacktrace information.
+ * @see set_stacktrace_policy()
+ */
+enum class stacktrace_policy {
+
+    /// @brief always captures stacktrace information.
+    always,
+
+    /// @brief captures stacktrace information only once in every sampling interval.
+    sampled,
+
+    /**
+     * @brief always captures only the raw frame addresses.
+     * @details print_trace() prints them without resolving their symbols,
+     *      so that they can be symbolized later outside of the process.
+     */
+    raw_addresses,
+
+    /// @brief never captures stacktrace information.
+    never,
+};
+
+/**
+ * @brief returns string representation of the value.
+ * @param value the target value
+ * @return the corresponded string representation
+ */
+constexpr inline std::string_view to_string_view(stacktrace_policy value) noexcept {
+    using namespace std::string_view_literals;
+    using kind = stacktrace_policy;
+    switch (value) {
+        case kind::always: return "always"sv;
+        case kind::sampled: return "sampled"sv;
+        case kind::raw_addresses: return "raw_addresses"sv;
+        case kind::never: return "never"sv;
+    }
+    std::abort();
+}
+
+/**
+ * @brief appends string representation of the given value.
+ * @param out the target output
+ * @param value the target value
+ * @return the output
+ */
+inline std::ostream& operator<<(std::ostream& out, stacktrace_policy value) {
+    return out << to_string_view(value);
+}
+
+} // namespace takatori::util
@@ -9,6 +9,7 @@
 #include <cstdint>
 
 #include "exception.h"
+#include "details/bit_operations.h"
 
 namespace takatori::util {
 
@@ -283,10 +284,8 @@ public:
      */
     [[nodiscard]] constexpr size_type count() const noexcept {
         size_type result = 0;
-        for (size_type i = 0; i < nbits; ++i) {
-            if (get_unsafe(i)) {
-                ++result;
-            }
+        for (size_type i = 0; i < nblocks; ++i) {
+            result += details::popcount(blocks_[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
         }
         return result;
     }
@@ -297,8 +296,8 @@ public:
      * @return false otherwise
      */
     [[nodiscard]] constexpr bool all() const noexcept {
-        for (size_type i = 0; i < nbits; ++i) {
-            if (!get_unsafe(i)) {
+        for (size_type i = 0; i < nblocks; ++i) {
+            if (blocks_[i] != block_mask(i)) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
                 return false;
             }
         }
@@ -311,8 +310,8 @@ public:
      * @return false otherwise
      */
     [[nodiscard]] constexpr bool any() const noexcept {
-        for (size_type i = 0; i < nbits; ++i) {
-            if (get_unsafe(i)) {
+        for (size_type i = 0; i < nblocks; ++i) {
+            if (blocks_[i] != 0) { // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
                 return true;
             }
         }
@@ -357,9 +356,17 @@ public:
      * @return npos if there are no `1` after the starting position
      */
     [[nodiscard]] constexpr size_type find(size_type start = 0, bool value = true) const noexcept {
-        for (size_type i = start; i < nbits; ++i) {
-            if (get_unsafe(i) == value) {
-                return i;
+        if (start >= nbits) {
+            return npos;
+        }
+        for (size_type i = block_offset(start); i < nblocks; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            auto block = static_cast<block_type>((value ? blocks_[i] : ~blocks_[i]) & block_mask(i));
+            if (i == block_offset(start)) {
+                block = static_cast<block_type>(block & ~details::lower_mask<block_type>(bit_offset(start)));
+            }
+            if (block != 0) {
+                return i * nbits_in_block + details::count_trailing_zeros(block);
             }
         }
         return npos;
@@ -508,8 +515,9 @@ public:
      * @return this
      */
     constexpr static_bitset& flip() noexcept {
-        for (size_type i = 0; i < nbits; ++i) {
-            flip_unsafe(i);
+        for (size_type i = 0; i < nblocks; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            blocks_[i] = static_cast<block_type>(~blocks_[i] & block_mask(i));
         }
         return *this;
     }
@@ -582,6 +590,14 @@ private:
     [[nodiscard]] constexpr size_type bit_mask(size_type position) const {
         return size_type{1} << bit_offset(position);
     }
+
+    // returns the available bits in the given block, to keep the trailing bits of the last block `0`
+    [[nodiscard]] static constexpr block_type block_mask(size_type block_index) noexcept {
+        if (block_index + 1 < nblocks) {
+            return static_cast<block_type>(~block_type {});
+        }
+        return details::lower_mask<block_type>(nbits - block_index * nbits_in_block);
+    }
 };
 
 /**
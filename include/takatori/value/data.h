@@ -5,13 +5,15 @@
 
 #include "value_kind.h"
 
+#include <takatori/util/object_memory.h>
+
 
 namespace takatori::value {
 
 /**
  * @brief a root model of polymorphic values.
  */
-class data {
+class data : public util::object_memory_support {
 public:
     /**
      * @brief destroys this object.
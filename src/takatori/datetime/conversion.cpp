@@ -1,13 +1,18 @@
 #include <takatori/datetime/conversion.h>
 
+#include <algorithm>
 #include <string>
 
+#include "date_util.h"
+#include "parser/canonical_parser.h"
 #include "parser/parser.h"
 
 namespace takatori::datetime {
 
 using std::string_literals::operator""s; // NOLINT(*-unused-using-decls)
 
+using ::takatori::util::sequence_view;
+
 namespace {
 
 std::optional<std::string> validate_date(date_info const& info) {
@@ -70,11 +75,56 @@ std::optional<std::string> require_offset(std::optional<zone_offset_info> const&
     return validate_offset(*info);
 }
 
+parser::parser::result_type parse_contents(std::string_view contents) {
+    // fast path: avoid building the grammar based parser for the typical forms
+    if (auto info = parser::parse_canonical(contents)) {
+        return std::move(*info);
+    }
+    parser::parser p {};
+    return p(contents);
+}
+
+bool is_valid_year(date_info const& info) noexcept {
+    return info.year <= static_cast<std::uint32_t>(util::max_year);
+}
+
+date to_date(date_info const& info) {
+    return date {
+            static_cast<date::year_value_type>(info.year),
+            info.month,
+            info.day,
+    };
+}
+
+time_of_day to_time_of_day(time_info const& info) {
+    return time_of_day {
+            info.hour,
+            info.minute,
+            info.second,
+            std::chrono::duration_cast<time_of_day::time_unit>(info.subsecond),
+    };
+}
+
+template<class T, class Parser, class Converter>
+std::size_t parse_each(
+        sequence_view<std::string_view const> contents,
+        sequence_view<T> results,
+        Parser&& parse,
+        Converter&& converter) {
+    auto size = std::min(contents.size(), results.size());
+    for (std::size_t index = 0; index < size; ++index) {
+        auto result = parse(contents[index]);
+        if (!result || !converter(result.value(), results[index])) {
+            return index;
+        }
+    }
+    return size;
+}
+
 } // namespace
 
 conversion_result<date_info> parse_date(std::string_view contents) {
-    parser::parser p {};
-    auto result = p(contents);
+    auto result = parse_contents(contents);
     if (!result) {
         return std::move(result.error().message);
     }
@@ -92,8 +142,7 @@ conversion_result<date_info> parse_date(std::string_view contents) {
 }
 
 conversion_result<time_info> parse_time(std::string_view contents) {
-    parser::parser p {};
-    auto result = p(contents);
+    auto result = parse_contents(contents);
     if (!result) {
         return std::move(result.error().message);
     }
@@ -111,8 +160,7 @@ conversion_result<time_info> parse_time(std::string_view contents) {
 }
 
 conversion_result<datetime_info> parse_datetime(std::string_view contents) {
-    parser::parser p {};
-    auto result = p(contents);
+    auto result = parse_contents(contents);
     if (!result) {
         return std::move(result.error().message);
     }
@@ -137,8 +185,7 @@ conversion_result<datetime_info> parse_datetime(std::string_view contents) {
 }
 
 conversion_result<zone_offset_info> parse_zone_offset(std::string_view contents) {
-    parser::parser p {};
-    auto result = p(contents);
+    auto result = parse_contents(contents);
     if (!result) {
         return std::move(result.error().message);
     }
@@ -155,4 +202,45 @@ conversion_result<zone_offset_info> parse_zone_offset(std::string_view contents)
     return *info.offset; // NOLINT(bugprone-unchecked-optional-access) - checked in require_offset()
 }
 
+std::size_t parse_dates(
+        sequence_view<std::string_view const> contents,
+        sequence_view<date> results) {
+    return parse_each(contents, results, parse_date, [](date_info const& info, date& result) {
+        if (!is_valid_year(info)) {
+            return false;
+        }
+        result = to_date(info);
+        return true;
+    });
+}
+
+std::size_t parse_times(
+        sequence_view<std::string_view const> contents,
+        sequence_view<time_of_day> results) {
+    return parse_each(contents, results, parse_time, [](time_info const& info, time_of_day& result) {
+        result = to_time_of_day(info);
+        return true;
+    });
+}
+
+std::size_t parse_datetimes(
+        sequence_view<std::string_view const> contents,
+        sequence_view<time_point> results) {
+    return parse_each(contents, results, parse_datetime, [](datetime_info const& info, time_point& result) {
+        if (!is_valid_year(info.date)) {
+            return false;
+        }
+        time_point local { to_date(info.date), to_time_of_day(info.time) };
+        if (!info.offset) {
+            result = local;
+            return true;
+        }
+        // local = UTC + offset
+        auto&& offset = *info.offset;
+        std::chrono::minutes shift { offset.hour * 60 + offset.minute };
+        result = offset.plus ? local - shift : local + shift;
+        return true;
+    });
+}
+
 } // namespace takatori::datetime
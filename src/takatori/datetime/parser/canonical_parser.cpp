@@ -0,0 +1,212 @@
+#include "canonical_parser.h"
+
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace takatori::datetime::parser {
+
+namespace {
+
+class cursor {
+public:
+    explicit cursor(std::string_view contents) noexcept :
+        contents_ { contents }
+    {}
+
+    [[nodiscard]] bool eof() const noexcept {
+        return position_ >= contents_.size();
+    }
+
+    [[nodiscard]] char peek(std::size_t offset = 0) const noexcept {
+        if (position_ + offset >= contents_.size()) {
+            return '\0';
+        }
+        return contents_[position_ + offset];
+    }
+
+    [[nodiscard]] bool consume(char c) noexcept {
+        if (peek() != c) {
+            return false;
+        }
+        ++position_;
+        return true;
+    }
+
+    /**
+     * @brief consumes just the given number of decimal digits.
+     * @details This only accumulates the digits and then tests all of them at once, to avoid branches for each digit.
+     * @param count the number of digits
+     * @return the decimal value
+     * @return empty if the remaining contents does not start with the given number of digits
+     */
+    [[nodiscard]] std::optional<std::uint32_t> digits(std::size_t count) noexcept {
+        if (contents_.size() - position_ < count) {
+            return {};
+        }
+        std::uint32_t result = 0;
+        bool valid = true;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto digit = static_cast<std::uint32_t>(static_cast<unsigned char>(contents_[position_ + i])) - '0';
+            valid &= digit < 10U;
+            result = result * 10U + digit;
+        }
+        if (!valid) {
+            return {};
+        }
+        position_ += count;
+        return result;
+    }
+
+    /**
+     * @brief consumes a sequence of decimal digits up to the given count.
+     * @param max_count the max number of digits
+     * @return the decimal value and the number of digits
+     */
+    [[nodiscard]] std::pair<std::uint32_t, std::size_t> digits_up_to(std::size_t max_count) noexcept {
+        std::uint32_t result = 0;
+        std::size_t count = 0;
+        while (count <= max_count) {
+            auto digit = static_cast<std::uint32_t>(static_cast<unsigned char>(peek())) - '0';
+            if (digit >= 10U) {
+                break;
+            }
+            result = result * 10U + digit;
+            ++count;
+            ++position_;
+        }
+        return { result, count };
+    }
+
+private:
+    std::string_view contents_;
+    std::size_t position_ {};
+};
+
+constexpr std::size_t max_subsecond_digits = 9;
+
+std::optional<date_info> parse_date(cursor& c) noexcept {
+    auto year = c.digits(4);
+    if (!year || !c.consume('-')) {
+        return {};
+    }
+    auto month = c.digits(2);
+    if (!month || !c.consume('-')) {
+        return {};
+    }
+    auto day = c.digits(2);
+    if (!day) {
+        return {};
+    }
+    return date_info { *year, *month, *day };
+}
+
+std::optional<time_info> parse_time(cursor& c) noexcept {
+    auto hour = c.digits(2);
+    if (!hour || !c.consume(':')) {
+        return {};
+    }
+    auto minute = c.digits(2);
+    if (!minute || !c.consume(':')) {
+        return {};
+    }
+    auto second = c.digits(2);
+    if (!second) {
+        return {};
+    }
+    time_info result { *hour, *minute, *second, {} };
+    if (c.consume('.')) {
+        auto [value, count] = c.digits_up_to(max_subsecond_digits);
+        if (count == 0 || count > max_subsecond_digits) {
+            return {};
+        }
+        for (std::size_t i = count; i < max_subsecond_digits; ++i) {
+            value *= 10U;
+        }
+        result.subsecond = time_info::subsecond_type { value };
+    }
+    return result;
+}
+
+std::optional<zone_offset_info> parse_offset(cursor& c) noexcept {
+    if (c.consume('Z')) {
+        return zone_offset_info {};
+    }
+    bool plus {};
+    if (c.consume('+')) {
+        plus = true;
+    } else if (c.consume('-')) {
+        plus = false;
+    } else {
+        return {};
+    }
+    auto hour = c.digits(2);
+    if (!hour) {
+        return {};
+    }
+    if (c.eof()) {
+        return zone_offset_info { plus, *hour, 0 };
+    }
+    if (!c.consume(':')) {
+        return {};
+    }
+    auto minute = c.digits(2);
+    if (!minute) {
+        return {};
+    }
+    return zone_offset_info { plus, *hour, *minute };
+}
+
+bool parse_offset_opt(cursor& c, parser_result_info& result) noexcept {
+    if (c.eof()) {
+        return true;
+    }
+    if (auto offset = parse_offset(c)) {
+        result.offset = *offset;
+        return c.eof();
+    }
+    return false;
+}
+
+} // namespace
+
+std::optional<parser_result_info> parse_canonical(std::string_view contents) noexcept {
+    cursor c { contents };
+    parser_result_info result {};
+    if (c.peek(4) == '-') {
+        // YYYY-MM-DD
+        result.date = parse_date(c);
+        if (!result.date) {
+            return {};
+        }
+        if (c.eof()) {
+            return result;
+        }
+        if (!c.consume(' ') && !c.consume('T')) {
+            return {};
+        }
+        // YYYY-MM-DD hh:mm:ss
+        result.time = parse_time(c);
+        if (!result.time || !parse_offset_opt(c, result)) {
+            return {};
+        }
+        return result;
+    }
+    if (c.peek(2) == ':') {
+        // hh:mm:ss
+        result.time = parse_time(c);
+        if (!result.time || !parse_offset_opt(c, result)) {
+            return {};
+        }
+        return result;
+    }
+    // offset only
+    result.offset = parse_offset(c);
+    if (!result.offset || !c.eof()) {
+        return {};
+    }
+    return result;
+}
+
+} // namespace takatori::datetime::parser
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include "parser_result_info.h"
+
+namespace takatori::datetime::parser {
+
+/**
+ * @brief parses the given contents only if it is in the canonical forms, without building the grammar based parser.
+ * @details This accepts the following forms, and the results are equivalent to the grammar based parser:
+ *
+ *      * `YYYY-MM-DD`
+ *      * `hh:mm:ss[.SSSSSSSSS][offset]`
+ *      * `YYYY-MM-DD(' '|'T')hh:mm:ss[.SSSSSSSSS][offset]`
+ *      * `offset`
+ *
+ *      where the `offset` is one of `Z`, `+HH`, or `+HH:MM` (or its negative form), and the sub-second field has
+ *      1 to 9 digits. The field values are not validated here.
+ * @param contents the source contents
+ * @return the parsed information
+ * @return empty if the contents is not in the canonical forms, then please use the grammar based parser instead
+ */
+[[nodiscard]] std::optional<parser_result_info> parse_canonical(std::string_view contents) noexcept;
+
+} // namespace takatori::datetime::parser
@@ -1,5 +1,11 @@
 #include <takatori/datetime/time_zone.h>
 
+#include <functional>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
 #include <takatori/util/exception.h>
 
 #include "time_zone_impl.h"
@@ -10,17 +16,56 @@ using ::takatori::util::throw_exception;
 
 time_zone const time_zone::UTC { impl::utc() }; // NOLINT
 
-static std::shared_ptr<time_zone::impl> from_offset(std::chrono::minutes offset, bool or_throw) {
+namespace {
+
+/**
+ * @brief a process-wide cache of resolved time zones.
+ * @details Resolving a time zone by ICU is costly, and the resolved ones are immutable.
+ */
+template<class Key>
+class time_zone_cache {
+public:
+    using entity_type = std::shared_ptr<time_zone::impl>;
+
+    template<class K, class Factory>
+    entity_type get(K const& key, Factory&& factory) {
+        {
+            std::shared_lock lock { mutex_ };
+            if (auto iter = entries_.find(key); iter != entries_.end()) {
+                return iter->second;
+            }
+        }
+        // NOTE: don't block the other threads while resolving the time zone
+        auto created = factory();
+        if (!created) {
+            return created;
+        }
+        std::unique_lock lock { mutex_ };
+        auto [iter, success] = entries_.emplace(Key { key }, std::move(created));
+        (void) success;
+        return iter->second;
+    }
+
+private:
+    std::shared_mutex mutex_ {};
+    std::map<Key, entity_type, std::less<>> entries_ {};
+};
+
+time_zone_cache<std::string>& symbol_cache() {
+    static time_zone_cache<std::string> cache {};
+    return cache;
+}
+
+time_zone_cache<std::chrono::minutes::rep>& offset_cache() {
+    static time_zone_cache<std::chrono::minutes::rep> cache {};
+    return cache;
+}
+
+} // namespace
+
+static std::shared_ptr<time_zone::impl> create_from_offset(std::chrono::minutes offset) {
     using impl = time_zone::impl;
     using namespace std::chrono;
-    using namespace std::chrono_literals;
-    if (offset == 0min) {
-        return impl::utc();
-    }
-    if (offset <= -24h || offset >= +24h) {
-        if (or_throw) throw_exception(std::out_of_range("invalid time zone offset"));
-        return {};
-    }
     auto abs_offset = offset.count() < 0 ? -offset : offset;
     auto hour_part = duration_cast<hours>(abs_offset);
     auto minute_part = abs_offset - hour_part;
@@ -39,8 +84,33 @@ static std::shared_ptr<time_zone::impl> from_offset(std::chrono::minutes offset,
     return std::make_shared<impl>(buffer.data(), std::move(entity));
 }
 
-static std::shared_ptr<time_zone::impl> from_symbol(std::string_view symbol, bool or_throw) {
+static std::shared_ptr<time_zone::impl> create_from_symbol(std::string_view symbol) {
+    using impl = time_zone::impl;
+    icu::UnicodeString string { symbol.data(), static_cast<std::int32_t>(symbol.size()) };
+    std::unique_ptr<impl::entity_type> entity { impl::entity_type::createTimeZone(string) };
+    if (*entity == impl::entity_type::getUnknown()) { // NOLINT(readability-implicit-bool-conversion) -- for ICU <= 69
+        return {};
+    }
+    return std::make_shared<impl>(std::string { symbol }, std::move(entity));
+}
+
+static std::shared_ptr<time_zone::impl> from_offset(std::chrono::minutes offset, bool or_throw) {
     using impl = time_zone::impl;
+    using namespace std::chrono;
+    using namespace std::chrono_literals;
+    if (offset == 0min) {
+        return impl::utc();
+    }
+    if (offset <= -24h || offset >= +24h) {
+        if (or_throw) throw_exception(std::out_of_range("invalid time zone offset"));
+        return {};
+    }
+    return offset_cache().get(offset.count(), [&] {
+        return create_from_offset(offset);
+    });
+}
+
+static std::shared_ptr<time_zone::impl> from_symbol(std::string_view symbol, bool or_throw) {
     using namespace std::string_view_literals;
     if (symbol.empty()) {
         if (or_throw) throw_exception(std::invalid_argument("empty time zone symbol"));
@@ -49,13 +119,14 @@ static std::shared_ptr<time_zone::impl> from_symbol(std::string_view symbol, boo
     if (symbol == "UTC"sv) {
         return time_zone::impl::utc();
     }
-    icu::UnicodeString string { symbol.data(), static_cast<std::int32_t>(symbol.size()) };
-    std::unique_ptr<impl::entity_type> entity { impl::entity_type::createTimeZone(string) };
-    if (*entity == impl::entity_type::getUnknown()) { // NOLINT(readability-implicit-bool-conversion) -- for ICU <= 69
+    auto result = symbol_cache().get(symbol, [&] {
+        return create_from_symbol(symbol);
+    });
+    if (!result) {
         if (or_throw) throw_exception(std::invalid_argument(std::string("unknown time zone symbol: ") += symbol));
         return {};
     }
-    return std::make_shared<impl>(std::string { symbol }, std::move(entity));
+    return result;
 }
 
 time_zone::time_zone()
@@ -82,6 +153,21 @@ std::chrono::minutes time_zone::offset() const noexcept {
     return impl_->offset();
 }
 
+std::chrono::seconds time_zone::offset_at(time_point at) const noexcept {
+    return impl_->offset_at(at.seconds_since_epoch().count());
+}
+
+time_point time_zone::to_local(time_point at) const noexcept {
+    return at + offset_at(at);
+}
+
+void time_zone::to_local(util::sequence_view<time_point const> source, util::sequence_view<time_point> destination) const {
+    if (destination.size() < source.size()) {
+        throw_exception(std::invalid_argument("destination is too short"));
+    }
+    impl_->to_local(source, destination);
+}
+
 bool operator==(time_zone const& a, time_zone const& b) noexcept {
     return *a.impl_ == *b.impl_;
 }
@@ -1,7 +1,22 @@
 #include "time_zone_impl.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <unicode/basictz.h>
+#include <unicode/tzrule.h>
+#include <unicode/tztrans.h>
+
 namespace takatori::datetime {
 
+/// @brief the beginning of the transition table: 1900-01-01 00:00:00 UTC.
+static constexpr std::int64_t transition_table_begin = -2'208'988'800LL;
+
+/// @brief the end of the transition table (exclusive): 2100-01-01 00:00:00 UTC.
+static constexpr std::int64_t transition_table_end = 4'102'444'800LL;
+
+static constexpr double milliseconds_per_second = 1000.0;
+
 std::shared_ptr<time_zone::impl> time_zone::impl::utc() {
     static std::shared_ptr<impl> const object = std::make_shared<impl>(
             std::string { "UTC" },
@@ -24,6 +39,7 @@ time_zone::impl::impl(std::string name, std::unique_ptr<entity_type> entity)
     } else {
         lid.toUTF8String(id_);
     }
+    build_transitions();
 }
 
 std::string const& time_zone::impl::id() const noexcept {
@@ -39,6 +55,87 @@ std::chrono::minutes time_zone::impl::offset() const noexcept {
     return std::chrono::duration_cast<std::chrono::minutes>(offset);
 }
 
+std::chrono::seconds time_zone::impl::offset_at(std::int64_t seconds) const noexcept {
+    if (!in_table(seconds)) {
+        return offset_from_entity(seconds);
+    }
+    return std::chrono::seconds { transition_offsets_[find_segment(seconds)] };
+}
+
+void time_zone::impl::to_local(
+        util::sequence_view<time_point const> source,
+        util::sequence_view<time_point> destination) const noexcept {
+    // the cached segment, which is often shared with the next element
+    std::int64_t segment_begin = 0;
+    std::int64_t segment_end = 0;
+    std::chrono::seconds segment_offset {};
+    for (std::size_t i = 0, n = source.size(); i < n; ++i) {
+        auto&& value = source[i];
+        auto seconds = value.seconds_since_epoch().count();
+        if (seconds < segment_begin || seconds >= segment_end) {
+            if (!in_table(seconds)) {
+                destination[i] = value + offset_from_entity(seconds);
+                continue;
+            }
+            auto index = find_segment(seconds);
+            segment_begin = transition_times_[index];
+            segment_end = index + 1 < transition_times_.size() ? transition_times_[index + 1] : transition_table_end;
+            segment_offset = std::chrono::seconds { transition_offsets_[index] };
+        }
+        destination[i] = value + segment_offset;
+    }
+}
+
+void time_zone::impl::build_transitions() {
+    auto const* rules = dynamic_cast<icu::BasicTimeZone const*>(entity_.get());
+    if (rules == nullptr) {
+        // always asks to the entity
+        return;
+    }
+    transition_times_.emplace_back(transition_table_begin);
+    transition_offsets_.emplace_back(static_cast<std::int32_t>(offset_from_entity(transition_table_begin).count()));
+
+    icu::TimeZoneTransition transition {};
+    auto current = static_cast<UDate>(transition_table_begin) * milliseconds_per_second;
+    while (rules->getNextTransition(current, false, transition)) {
+        current = transition.getTime();
+        auto seconds = static_cast<std::int64_t>(std::floor(current / milliseconds_per_second));
+        if (seconds >= transition_table_end) {
+            break;
+        }
+        auto const* rule = transition.getTo();
+        auto offset = static_cast<std::int32_t>((rule->getRawOffset() + rule->getDSTSavings()) / 1000);
+        if (offset == transition_offsets_.back()) {
+            continue;
+        }
+        transition_times_.emplace_back(seconds);
+        transition_offsets_.emplace_back(offset);
+    }
+}
+
+std::chrono::seconds time_zone::impl::offset_from_entity(std::int64_t seconds) const noexcept {
+    std::int32_t raw_offset {};
+    std::int32_t dst_offset {};
+    UErrorCode status = U_ZERO_ERROR;
+    entity_->getOffset(static_cast<UDate>(seconds) * milliseconds_per_second, false, raw_offset, dst_offset, status);
+    if (U_FAILURE(status)) { // NOLINT
+        raw_offset = entity_->getRawOffset();
+        dst_offset = 0;
+    }
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::milliseconds { raw_offset + dst_offset });
+}
+
+bool time_zone::impl::in_table(std::int64_t seconds) const noexcept {
+    return !transition_times_.empty()
+        && transition_table_begin <= seconds
+        && seconds < transition_table_end;
+}
+
+std::size_t time_zone::impl::find_segment(std::int64_t seconds) const noexcept {
+    auto iter = std::upper_bound(transition_times_.begin(), transition_times_.end(), seconds);
+    return static_cast<std::size_t>(std::distance(transition_times_.begin(), iter)) - 1;
+}
+
 icu::TimeZone const& time_zone::impl::entity() const noexcept {
     return *entity_;
 }
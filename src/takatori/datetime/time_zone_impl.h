@@ -1,14 +1,20 @@
 #pragma once
 
 #include <takatori/datetime/time_zone.h>
+#include <takatori/datetime/time_point.h>
 
 #include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
+
+#include <cstdint>
 
 #include <unicode/timezone.h>
 #include <unicode/ustring.h>
 
+#include <takatori/util/sequence_view.h>
+
 namespace takatori::datetime {
 
 /**
@@ -50,6 +56,22 @@ public:
      */
     [[nodiscard]] std::chrono::minutes offset() const noexcept;
 
+    /**
+     * @brief returns the offset from UTC at the given time, including daylight saving time.
+     * @details This only looks up the pre-computed transition table if the time is in the table range,
+     *      or otherwise asks to the time zone entity.
+     * @param seconds the target time, in seconds since 1970-01-01 00:00:00 UTC
+     * @return the offset from UTC
+     */
+    [[nodiscard]] std::chrono::seconds offset_at(std::int64_t seconds) const noexcept;
+
+    /**
+     * @brief converts each time point in UTC into the local time point.
+     * @param source the source time points in UTC
+     * @param destination the destination, must be at least as long as the source
+     */
+    void to_local(util::sequence_view<time_point const> source, util::sequence_view<time_point> destination) const noexcept;
+
     /**
      * @brief returns the time zone entity.
      * @return the time zone entity
@@ -107,6 +129,17 @@ private:
     std::string id_ {};
     std::string name_;
     std::unique_ptr<entity_type> entity_;
+
+    /// @brief the beginning time of each offset segment, in seconds since epoch.
+    std::vector<std::int64_t> transition_times_ {};
+
+    /// @brief the offset seconds of each segment, which is valid until the next segment begins.
+    std::vector<std::int32_t> transition_offsets_ {};
+
+    void build_transitions();
+    [[nodiscard]] std::chrono::seconds offset_from_entity(std::int64_t seconds) const noexcept;
+    [[nodiscard]] bool in_table(std::int64_t seconds) const noexcept;
+    [[nodiscard]] std::size_t find_segment(std::int64_t seconds) const noexcept;
 };
 
 } // namespace takatori::datetime
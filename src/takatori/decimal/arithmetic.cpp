@@ -0,0 +1,306 @@
+#include <takatori/decimal/arithmetic.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include <takatori/util/exception.h>
+
+namespace takatori::decimal {
+
+using util::throw_exception;
+
+namespace {
+
+// NOTE: GCC and Clang extension, only used in this translation unit
+__extension__ using uint128 = unsigned __int128;
+
+constexpr std::array<uint128, max_precision + 1> build_powers() noexcept {
+    std::array<uint128, max_precision + 1> results {};
+    uint128 current = 1;
+    for (auto&& result : results) {
+        result = current;
+        current *= 10;
+    }
+    return results;
+}
+
+constexpr std::array<uint128, max_precision + 1> powers_of_ten = build_powers();
+
+// the max coefficient of results
+constexpr uint128 coefficient_max = powers_of_ten[max_precision] - 1;
+
+constexpr uint128 uint128_max = ~uint128 { 0 };
+
+constexpr uint128 coefficient_of(triple value) noexcept {
+    return (static_cast<uint128>(value.coefficient_high()) << 64U) | value.coefficient_low();
+}
+
+constexpr triple make_triple(std::int64_t sign, uint128 coefficient, std::int32_t exponent) noexcept {
+    return triple {
+            sign,
+            static_cast<std::uint64_t>(coefficient >> 64U),
+            static_cast<std::uint64_t>(coefficient),
+            exponent,
+    };
+}
+
+constexpr triple negate(triple value) noexcept {
+    return triple {
+            -value.sign(),
+            value.coefficient_high(),
+            value.coefficient_low(),
+            value.exponent(),
+    };
+}
+
+// multiplies the coefficient by 10^digits, or returns empty if the result exceeds the limit
+constexpr std::optional<uint128> scale_up(uint128 coefficient, std::int64_t digits, uint128 limit) noexcept {
+    if (coefficient == 0) {
+        return uint128 { 0 };
+    }
+    if (digits > max_precision) {
+        // 10^39 > 2^128
+        return {};
+    }
+    auto factor = powers_of_ten[digits]; // NOLINT
+    if (coefficient > limit / factor) {
+        return {};
+    }
+    return coefficient * factor;
+}
+
+int compare_magnitude(triple left, triple right) noexcept {
+    auto a = coefficient_of(left);
+    auto b = coefficient_of(right);
+    auto ea = static_cast<std::int64_t>(left.exponent());
+    auto eb = static_cast<std::int64_t>(right.exponent());
+    if (ea > eb) {
+        auto scaled = scale_up(a, ea - eb, uint128_max);
+        if (!scaled) {
+            return +1;
+        }
+        a = *scaled;
+    } else if (ea < eb) {
+        auto scaled = scale_up(b, eb - ea, uint128_max);
+        if (!scaled) {
+            return -1;
+        }
+        b = *scaled;
+    }
+    if (a < b) {
+        return -1;
+    }
+    if (a > b) {
+        return +1;
+    }
+    return 0;
+}
+
+template<class Operation>
+triple fallback(triple left, triple right, Operation&& operation) {
+    ::decimal::Context context { ::decimal::context };
+    context.prec(max_precision);
+    auto result = operation(
+            static_cast<::decimal::Decimal>(left),
+            static_cast<::decimal::Decimal>(right),
+            context);
+    return triple { result };
+}
+
+template<class Operation>
+void apply_each(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results,
+        Operation&& operation) {
+    if (left.size() != right.size() || left.size() != results.size()) {
+        throw_exception(std::invalid_argument("inconsistent number of operands"));
+    }
+    for (std::size_t i = 0, n = results.size(); i < n; ++i) {
+        results[i] = operation(left[i], right[i]);
+    }
+}
+
+} // namespace
+
+int compare(triple left, triple right) noexcept {
+    if (left.sign() != right.sign()) {
+        return left.sign() < right.sign() ? -1 : +1;
+    }
+    if (left.sign() == 0) {
+        return 0;
+    }
+    auto magnitude = compare_magnitude(left, right);
+    return left.sign() > 0 ? magnitude : -magnitude;
+}
+
+std::optional<triple> try_add(triple left, triple right) noexcept {
+    auto exponent = std::min(left.exponent(), right.exponent());
+    auto a = scale_up(
+            coefficient_of(left),
+            static_cast<std::int64_t>(left.exponent()) - exponent,
+            coefficient_max);
+    auto b = scale_up(
+            coefficient_of(right),
+            static_cast<std::int64_t>(right.exponent()) - exponent,
+            coefficient_max);
+    if (!a || !b) {
+        return {};
+    }
+    if (left.sign() == 0) {
+        return make_triple(right.sign(), *b, exponent);
+    }
+    if (right.sign() == 0) {
+        return make_triple(left.sign(), *a, exponent);
+    }
+    if (left.sign() == right.sign()) {
+        // never overflow: (10^38 - 1) * 2 < 2^128
+        auto total = *a + *b;
+        if (total > coefficient_max) {
+            return {};
+        }
+        return make_triple(left.sign(), total, exponent);
+    }
+    if (*a >= *b) {
+        return make_triple(left.sign(), *a - *b, exponent);
+    }
+    return make_triple(right.sign(), *b - *a, exponent);
+}
+
+std::optional<triple> try_subtract(triple left, triple right) noexcept {
+    return try_add(left, negate(right));
+}
+
+std::optional<triple> try_multiply(triple left, triple right) noexcept {
+    auto exponent = static_cast<std::int64_t>(left.exponent()) + right.exponent();
+    if (exponent < std::numeric_limits<std::int32_t>::min()
+            || exponent > std::numeric_limits<std::int32_t>::max()) {
+        return {};
+    }
+    auto a = coefficient_of(left);
+    auto b = coefficient_of(right);
+    if (a != 0 && b > coefficient_max / a) {
+        return {};
+    }
+    return make_triple(
+            static_cast<std::int64_t>(left.sign()) * right.sign(),
+            a * b,
+            static_cast<std::int32_t>(exponent));
+}
+
+triple add(triple left, triple right) {
+    if (auto result = try_add(left, right)) {
+        return *result;
+    }
+    return fallback(left, right, [](auto const& a, auto const& b, auto& context) {
+        return a.add(b, context);
+    });
+}
+
+triple subtract(triple left, triple right) {
+    if (auto result = try_subtract(left, right)) {
+        return *result;
+    }
+    return fallback(left, right, [](auto const& a, auto const& b, auto& context) {
+        return a.sub(b, context);
+    });
+}
+
+triple multiply(triple left, triple right) {
+    if (auto result = try_multiply(left, right)) {
+        return *result;
+    }
+    return fallback(left, right, [](auto const& a, auto const& b, auto& context) {
+        return a.mul(b, context);
+    });
+}
+
+std::optional<triple> rescale(triple value, std::int32_t exponent, rounding_mode mode) noexcept {
+    if (value.sign() == 0) {
+        return triple { 0, 0, 0, exponent };
+    }
+    auto current = static_cast<std::int64_t>(value.exponent());
+    auto coefficient = coefficient_of(value);
+    if (exponent == current) {
+        return value;
+    }
+    if (exponent < current) {
+        auto scaled = scale_up(coefficient, current - exponent, coefficient_max);
+        if (!scaled) {
+            return {};
+        }
+        return make_triple(value.sign(), *scaled, exponent);
+    }
+    auto digits = exponent - current;
+    if (digits > max_precision) {
+        // the coefficient is always less than half of 10^digits
+        return triple { 0, 0, 0, exponent };
+    }
+    auto divisor = powers_of_ten[digits]; // NOLINT
+    auto quotient = coefficient / divisor;
+    auto remainder = coefficient % divisor;
+    // never overflow: remainder * 2 < 10^38 * 2 < 2^128
+    auto twice = remainder * 2;
+    switch (mode) {
+        case rounding_mode::down:
+            break;
+        case rounding_mode::half_up:
+            if (twice >= divisor) {
+                ++quotient;
+            }
+            break;
+        case rounding_mode::half_even:
+            if (twice > divisor || (twice == divisor && (quotient & 1U) != 0)) {
+                ++quotient;
+            }
+            break;
+    }
+    return make_triple(value.sign(), quotient, exponent);
+}
+
+triple round(triple value, std::int32_t scale, rounding_mode mode) noexcept {
+    auto exponent = std::min(
+            -static_cast<std::int64_t>(scale),
+            static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::max()));
+    if (value.exponent() >= exponent) {
+        return value;
+    }
+    // never empty because it only increases the exponent
+    return *rescale(value, static_cast<std::int32_t>(exponent), mode);
+}
+
+triple sum(util::sequence_view<triple const> values) {
+    if (values.empty()) {
+        return {};
+    }
+    auto total = values[0];
+    for (std::size_t i = 1, n = values.size(); i < n; ++i) {
+        total = add(total, values[i]);
+    }
+    return total;
+}
+
+void add(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results) {
+    apply_each(left, right, results, [](triple a, triple b) { return add(a, b); });
+}
+
+void subtract(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results) {
+    apply_each(left, right, results, [](triple a, triple b) { return subtract(a, b); });
+}
+
+void multiply(
+        util::sequence_view<triple const> left,
+        util::sequence_view<triple const> right,
+        util::sequence_view<triple> results) {
+    apply_each(left, right, results, [](triple a, triple b) { return multiply(a, b); });
+}
+
+} // namespace takatori::decimal
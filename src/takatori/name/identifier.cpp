@@ -6,15 +6,27 @@ identifier::identifier(token_type token) noexcept :
     token_ { std::move(token) }
 {}
 
+identifier::identifier(symbol token) noexcept :
+    symbol_ { token }
+{}
+
 identifier::token_type const& identifier::token() const noexcept {
+    if (symbol_) {
+        return symbol_.token();
+    }
     return token_;
 }
 
 identifier& identifier::token(token_type token) noexcept {
     token_ = std::move(token);
+    symbol_ = {};
     return *this;
 }
 
+symbol identifier::interned_symbol() const noexcept {
+    return symbol_;
+}
+
 document::region& identifier::region() noexcept {
     return region_;
 }
@@ -24,10 +36,16 @@ document::region const& identifier::region() const noexcept {
 }
 
 identifier::operator bool() const noexcept {
-    return !token_.empty();
+    return !token().empty();
 }
 
 bool operator==(identifier const& a, identifier const& b) noexcept {
+    auto sa = a.interned_symbol();
+    auto sb = b.interned_symbol();
+    if (sa && sb && sa.owner() == sb.owner()) {
+        // interned into the same table
+        return sa == sb;
+    }
     return a.token() == b.token();
 }
 
@@ -36,6 +54,9 @@ bool operator!=(identifier const& a, identifier const& b) noexcept {
 }
 
 bool operator<(identifier const& a, identifier const& b) noexcept {
+    if (auto sa = a.interned_symbol(); sa && sa == b.interned_symbol()) {
+        return false;
+    }
     return a.token() < b.token();
 }
 
@@ -58,6 +79,9 @@ std::ostream& operator<<(std::ostream& out, identifier const& value) {
 } // namespace takatori::name
 
 std::size_t std::hash<takatori::name::identifier>::operator()(takatori::name::identifier const& v) const noexcept {
+    if (auto s = v.interned_symbol()) {
+        return s.hash();
+    }
     std::hash<std::string_view> h {};
     return h(v.token());
 }
@@ -0,0 +1,70 @@
+#include <takatori/name/symbol_table.h>
+
+#include <mutex>
+#include <vector>
+
+namespace takatori::name {
+
+symbol symbol_table::intern(std::string_view token) {
+    {
+        std::shared_lock lock { mutex_ };
+        if (auto iter = index_.find(token); iter != index_.end()) {
+            return symbol { iter->second };
+        }
+    }
+    std::unique_lock lock { mutex_ };
+    if (auto iter = index_.find(token); iter != index_.end()) {
+        // interned by another thread
+        return symbol { iter->second };
+    }
+    auto&& entry = entries_.emplace_back(details::symbol_entry {
+            std::string { token },
+            std::hash<std::string_view> {}(token),
+            entries_.size(),
+            this,
+    });
+    // NOTE: the deque never moves its elements on emplace_back, so that the key refers the stable token
+    index_.emplace(entry.token, std::addressof(entry));
+    return symbol { std::addressof(entry) };
+}
+
+identifier symbol_table::intern_identifier(identifier const& id) {
+    if (!id || id.interned_symbol().owner() == this) {
+        return id;
+    }
+    identifier result { intern(id.token()) };
+    result.region() = id.region();
+    return result;
+}
+
+name symbol_table::intern_name(name const& n) {
+    std::vector<identifier> identifiers {};
+    identifiers.reserve(n.size());
+    for (auto&& id : n) {
+        identifiers.emplace_back(intern_identifier(id));
+    }
+    name result { std::move(identifiers) };
+    result.region() = n.region();
+    return result;
+}
+
+std::optional<symbol> symbol_table::find(std::string_view token) const {
+    std::shared_lock lock { mutex_ };
+    if (auto iter = index_.find(token); iter != index_.end()) {
+        return symbol { iter->second };
+    }
+    return {};
+}
+
+symbol_table::size_type symbol_table::size() const {
+    std::shared_lock lock { mutex_ };
+    return entries_.size();
+}
+
+symbol_table& symbol_table::global() {
+    // NOTE: never disposed, because interned names may be referred from the other static objects
+    static auto* instance = new symbol_table(); // NOLINT(cppcoreguidelines-owning-memory)
+    return *instance;
+}
+
+} // namespace takatori::name
@@ -1,6 +1,14 @@
 #include <takatori/plan/graph.h>
 
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <takatori/plan/process.h>
 #include <takatori/plan/exchange.h>
@@ -8,178 +16,276 @@
 #include <takatori/util/assertion.h>
 #include <takatori/util/clonable.h>
 #include <takatori/util/downcast.h>
+#include <takatori/util/object_memory.h>
 
-#include <takatori/graph/topological_sort.h>
+#include <takatori/serializer/details/fingerprint_scanner.h>
 
 namespace takatori::plan {
 
-using ::takatori::graph::topological_sort;
-
 using ::takatori::util::clone_unique;
 using ::takatori::util::unsafe_downcast;
 
-template<class T, class Mapping>
-static void repair_upstreams(Mapping const& mapping, step const& from, step& to) {
+namespace {
+
+/**
+ * @brief the copies of steps, indexed by the ordinal of their source steps.
+ */
+using copy_list = std::vector<step*>;
+
+template<class T>
+void repair_upstreams(graph_type const& source, copy_list const& copies, step const& from, step& to) {
     BOOST_ASSERT(from.kind() == to.kind()); // NOLINT
     auto&& from_t = unsafe_downcast<T>(from);
     auto&& to_t = unsafe_downcast<T>(to);
     for (auto&& from_up : from_t.upstreams()) {
-        if (auto it = mapping.find(std::addressof(from_up)); it != mapping.end()) {
-            auto&& to_up = unsafe_downcast<typename T::adjacent_type>(*it->second);
+        if (auto ordinal = source.ordinal(from_up); ordinal != graph_type::npos) {
+            auto&& to_up = unsafe_downcast<typename T::adjacent_type>(*copies[ordinal]);
             to_t.add_upstream(to_up);
         }
     }
 }
 
-void merge_into(graph_type const& source, graph_type& destination) {
-    std::unordered_map<
-            plan::step const*,
-            plan::step*,
-            std::hash<plan::step const*>,
-            std::equal_to<>> mapping {};
-    destination.reserve(destination.size() + source.size());
-    mapping.reserve(source.size());
-    for (auto&& e : source) {
-        auto&& copy = destination.insert(clone_unique(e));
-        mapping.emplace(std::addressof(e), std::addressof(copy));
-    }
-    for (auto [source, copy] : mapping) {
-        if (source->kind() == step_kind::process) {
-            repair_upstreams<process>(mapping, *source, *copy);
+void repair_connections(graph_type const& source, copy_list const& copies) {
+    std::size_t index = 0;
+    for (auto&& from : source) {
+        auto&& to = *copies[index++];
+        if (from.kind() == step_kind::process) {
+            repair_upstreams<process>(source, copies, from, to);
         } else {
-            repair_upstreams<exchange>(mapping, *source, *copy);
+            repair_upstreams<exchange>(source, copies, from, to);
         }
     }
 }
 
-void merge_into(graph_type&& source, graph_type& destination) {
-    destination.reserve(destination.size() + source.size());
-    destination.merge(std::move(source));
-}
-
-namespace {
+/**
+ * @brief the minimum number of operators to be copied by each worker thread.
+ * @details Creating a thread costs more than copying a few operators.
+ */
+constexpr std::size_t operators_per_thread = 64;
+
+/**
+ * @brief copies the operator graph of the individual processes.
+ */
+class operator_copier {
+public:
+    using target_list = std::vector<std::pair<process const*, process*>>;
+
+    explicit operator_copier(target_list targets) noexcept :
+        targets_ { std::move(targets) },
+        // the memory resource is bound to the individual threads
+        resource_ { util::object_memory_resource() }
+    {}
+
+    [[nodiscard]] target_list const& targets() const noexcept {
+        return targets_;
+    }
 
-template<class T>
-void upstreams0(T& s, std::function<void(T&)> const& consumer) {
-    if (s.kind() == step_kind::process) {
-        for (auto&& t : unsafe_downcast<process>(s).upstreams()) {
-            consumer(t);
+    /**
+     * @brief copies the operator graph of the target process on the current thread.
+     * @param index the target index
+     */
+    void copy(std::size_t index) noexcept {
+        if (cancelled_.load(std::memory_order_relaxed)) {
+            return;
         }
-    } else {
-        for (auto&& t : unsafe_downcast<exchange>(s).upstreams()) {
-            consumer(t);
+        util::object_memory_scope scope { resource_ };
+        auto [from, to] = targets_[index];
+        try {
+            relation::merge_into(from->operators(), to->operators());
+        } catch (...) {
+            std::lock_guard lock { mutex_ };
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+            // cancel the rest
+            cancelled_.store(true, std::memory_order_relaxed);
         }
     }
-}
 
-template<class T>
-void downstreams0(T& s, std::function<void(T&)> const& consumer) {
-    if (s.kind() == step_kind::process) {
-        for (auto&& t : unsafe_downcast<process>(s).downstreams()) {
-            consumer(t);
-        }
-    } else {
-        for (auto&& t : unsafe_downcast<exchange>(s).downstreams()) {
-            consumer(t);
+    /**
+     * @brief copies the rest operator graphs on the current thread.
+     */
+    void copy_rest() noexcept {
+        while (true) {
+            auto index = next_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= targets_.size()) {
+                break;
+            }
+            copy(index);
         }
     }
-}
 
-struct upstream_enumerator {
-    bool operator()(step const& s) const {
-        if (s.kind() == step_kind::process) {
-            return !unsafe_downcast<process>(s).upstreams().empty();
+    /**
+     * @brief re-throws the first error in the copy operations, if it exists.
+     */
+    void rethrow() const {
+        if (error_) {
+            std::rethrow_exception(error_);
         }
-        return !unsafe_downcast<exchange>(s).upstreams().empty();
-    }
-    void operator()(step& s, consumer_type const& consumer) const {
-        upstreams0(s, consumer);
-    }
-    void operator()(step const& s, const_consumer_type const& consumer) const {
-        upstreams0(s, consumer);
     }
+
+private:
+    target_list targets_;
+    std::pmr::memory_resource* resource_;
+    std::atomic_size_t next_ { 0 };
+    std::atomic_bool cancelled_ { false };
+    std::mutex mutex_ {};
+    std::exception_ptr error_ {};
 };
 
-struct downstream_enumerator {
-    bool operator()(step const& s) const {
-        if (s.kind() == step_kind::process) {
-            return !unsafe_downcast<process>(s).downstreams().empty();
+/**
+ * @brief copies the steps into the destination, except the operator graphs of the individual processes.
+ * @param source the source graph
+ * @param destination the destination graph
+ * @param copies the copies of the steps
+ * @return the processes whose operator graphs are not yet copied
+ */
+operator_copier::target_list copy_steps(graph_type const& source, graph_type& destination, copy_list& copies) {
+    destination.reserve(destination.size() + source.size());
+    copies.reserve(source.size());
+    operator_copier::target_list targets {};
+    for (auto&& e : source) {
+        if (e.kind() == step_kind::process) {
+            // copies the operator graph later
+            auto&& copy = destination.emplace<process>();
+            copies.emplace_back(std::addressof(copy));
+            targets.emplace_back(std::addressof(unsafe_downcast<process>(e)), std::addressof(copy));
+        } else {
+            auto&& copy = destination.insert(clone_unique(e));
+            copies.emplace_back(std::addressof(copy));
         }
-        return !unsafe_downcast<exchange>(s).downstreams().empty();
     }
-    void operator()(step& s, consumer_type const& consumer) const {
-        downstreams0(s, consumer);
+    return targets;
+}
+
+/**
+ * @brief returns the number of threads to copy the operator graphs.
+ * @param targets the target processes
+ * @param concurrency the max number of threads, including the current thread
+ * @return the number of threads, including the current thread
+ */
+std::size_t effective_concurrency(operator_copier::target_list const& targets, std::size_t concurrency) noexcept {
+    std::size_t operators = 0;
+    for (auto&& [from, to] : targets) {
+        (void) to;
+        operators += from->operators().size();
     }
-    void operator()(step const& s, const_consumer_type const& consumer) const {
-        downstreams0(s, consumer);
+    return std::max<std::size_t>(std::min({ concurrency, targets.size(), operators / operators_per_thread }), 1);
+}
+
+} // namespace
+
+void merge_into(graph_type const& source, graph_type& destination) {
+    destination.reserve(destination.size() + source.size());
+    copy_list copies {};
+    copies.reserve(source.size());
+    for (auto&& e : source) {
+        auto&& copy = destination.insert(clone_unique(e));
+        copies.emplace_back(std::addressof(copy));
     }
-};
+    repair_connections(source, copies);
+}
 
-template<class Enumerator, class Graph, class Step>
-void enumerate_edge0(Graph& g, std::function<void(Step&)> const& consumer) {
-    for (auto&& s : g) {
-        if (!Enumerator {}(s)) {
-            consumer(s);
+void merge_into(graph_type const& source, graph_type& destination, std::size_t concurrency) {
+    if (concurrency == 0) {
+        concurrency = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    copy_list copies {};
+    operator_copier copier { copy_steps(source, destination, copies) };
+    concurrency = effective_concurrency(copier.targets(), concurrency);
+
+    std::vector<std::thread> workers {};
+    workers.reserve(concurrency - 1);
+    for (std::size_t i = 1; i < concurrency; ++i) {
+        try {
+            workers.emplace_back([&] { copier.copy_rest(); });
+        } catch (std::system_error const&) {
+            // continue with the current workers
+            break;
         }
     }
+    copier.copy_rest();
+    for (auto&& thread : workers) {
+        thread.join();
+    }
+    copier.rethrow();
+    repair_connections(source, copies);
 }
 
-} // namespace
+void merge_into(graph_type const& source, graph_type& destination, executor_type const& executor) {
+    copy_list copies {};
+    operator_copier copier { copy_steps(source, destination, copies) };
+    if (!copier.targets().empty()) {
+        executor(copier.targets().size(), [&](std::size_t index) { copier.copy(index); });
+    }
+    copier.rethrow();
+    repair_connections(source, copies);
+}
+
+void merge_into(graph_type&& source, graph_type& destination) {
+    destination.reserve(destination.size() + source.size());
+    destination.merge(std::move(source));
+}
 
 bool has_upstream(step const& s) {
-    return upstream_enumerator {}(s);
+    return !upstreams(s).empty();
 }
 
 bool has_downstream(step const& s) {
-    return downstream_enumerator {}(s);
+    return !downstreams(s).empty();
 }
 
 void enumerate_top(graph_type& g, consumer_type const& consumer) {
-    enumerate_edge0<upstream_enumerator>(g, consumer);
+    enumerate_top<consumer_type const&>(g, consumer);
 }
 
 void enumerate_top(graph_type const& g, const_consumer_type const& consumer) {
-    enumerate_edge0<upstream_enumerator>(g, consumer);
+    enumerate_top<const_consumer_type const&>(g, consumer);
 }
 
 void enumerate_bottom(graph_type& g, consumer_type const& consumer) {
-    enumerate_edge0<downstream_enumerator>(g, consumer);
+    enumerate_bottom<consumer_type const&>(g, consumer);
 }
 
 void enumerate_bottom(graph_type const& g, const_consumer_type const& consumer) {
-    enumerate_edge0<downstream_enumerator>(g, consumer);
+    enumerate_bottom<const_consumer_type const&>(g, consumer);
 }
 
 void enumerate_upstream(step& s, consumer_type const& consumer) {
-    upstreams0(s, consumer);
+    enumerate_upstream<consumer_type const&>(s, consumer);
 }
 
 void enumerate_upstream(step const& s, const_consumer_type const& consumer) {
-    upstreams0(s, consumer);
+    enumerate_upstream<const_consumer_type const&>(s, consumer);
 }
 
 void enumerate_downstream(step& s, consumer_type const& consumer) {
-    downstreams0(s, consumer);
+    enumerate_downstream<consumer_type const&>(s, consumer);
 }
 
 void enumerate_downstream(step const& s, const_consumer_type const& consumer) {
-    downstreams0(s, consumer);
+    enumerate_downstream<const_consumer_type const&>(s, consumer);
 }
 
 void sort_from_upstream(graph_type& g, consumer_type const& consumer) {
-    topological_sort<upstream_enumerator>(g, consumer);
+    sort_from_upstream<consumer_type const&>(g, consumer);
 }
 
 void sort_from_upstream(graph_type const& g, const_consumer_type const& consumer) {
-    topological_sort<upstream_enumerator>(g, consumer);
+    sort_from_upstream<const_consumer_type const&>(g, consumer);
 }
 
 void sort_from_downstream(graph_type& g, consumer_type const& consumer) {
-    topological_sort<downstream_enumerator>(g, consumer);
+    sort_from_downstream<consumer_type const&>(g, consumer);
 }
 
 void sort_from_downstream(graph_type const& g, const_consumer_type const& consumer) {
-    topological_sort<downstream_enumerator>(g, consumer);
+    sort_from_downstream<const_consumer_type const&>(g, consumer);
+}
+
+util::fingerprint compute_fingerprint(graph_type const& g, bool mask_literals) {
+    serializer::details::fingerprint_scanner scanner { mask_literals };
+    return scanner.fingerprint(g);
 }
 
 } // namespace takatori::plan
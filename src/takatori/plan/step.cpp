@@ -36,6 +36,14 @@ void step::on_leave() noexcept {
     on_join(nullptr);
 }
 
+std::size_t step::graph_ordinal() const noexcept {
+    return graph_ordinal_;
+}
+
+void step::graph_ordinal(std::size_t ordinal) noexcept {
+    graph_ordinal_ = ordinal;
+}
+
 bool operator==(step const& a, step const& b) noexcept {
     return a.equals(b);
 }
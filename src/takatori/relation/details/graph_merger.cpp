@@ -9,11 +9,12 @@ graph_merger::graph_merger(graph_merger::graph_type& destination) noexcept :
 {}
 
 graph_merger& graph_merger::add(graph_merger::graph_type const& source) {
-    mappings_.reserve(source.size());
+    segments_.emplace_back(segment { std::addressof(source), copies_.size() });
+    copies_.reserve(copies_.size() + source.size());
     destination_.reserve(source.size() + destination_.size());
     for (auto&& s : source) {
         auto&& d = destination_.insert(s);
-        mappings_.emplace(std::addressof(s), std::addressof(d));
+        copies_.emplace_back(std::addressof(d));
     }
     return *this;
 }
@@ -24,8 +25,11 @@ graph_merger& graph_merger::add(graph_merger::graph_type&& source) {
 }
 
 graph_merger::graph_type& graph_merger::resolve() {
-    for (auto [src, dst] : mappings_) {
-        repair_connections(*src, *dst);
+    for (auto&& segment : segments_) {
+        auto index = segment.offset;
+        for (auto&& s : *segment.source) {
+            repair_connections(segment, s, *copies_[index++]);
+        }
     }
     return destination();
 }
@@ -34,30 +38,29 @@ graph_merger::graph_type& graph_merger::destination() const noexcept {
     return destination_;
 }
 
-graph_merger::node_mapping_type const& graph_merger::mappings() const noexcept {
-    return mappings_;
-}
-
-void graph_merger::repair_connections(node_type const& source, node_type& destination) {
+void graph_merger::repair_connections(segment const& hint, node_type const& source, node_type& destination) {
     auto&& source_inputs = source.input_ports();
     auto&& destination_inputs = destination.input_ports();
     auto source_iter = source_inputs.begin();
     auto destination_iter = destination_inputs.begin();
     while (source_iter != source_inputs.end()) {
         BOOST_ASSERT(destination_iter != destination_inputs.end()); // NOLINT
-        repair_opposite(*source_iter, *destination_iter);
+        repair_opposite(hint, *source_iter, *destination_iter);
         ++source_iter;
         ++destination_iter;
     }
     BOOST_ASSERT(destination_iter == destination_inputs.end()); // NOLINT
 }
 
-void graph_merger::repair_opposite(input_port_type const& source, input_port_type& destination) const {
+void graph_merger::repair_opposite(
+        segment const& hint,
+        input_port_type const& source,
+        input_port_type& destination) const {
     destination.disconnect_all();
     if (auto source_opposite = source.opposite()) {
         node_type const& source_upstream = source_opposite->owner();
         port_index_type output_index = source_opposite->index();
-        util::optional_ptr<node_type> destination_upstream = find(source_upstream);
+        util::optional_ptr<node_type> destination_upstream = find(hint, source_upstream);
         BOOST_ASSERT(destination_upstream); // NOLINT
         BOOST_ASSERT(output_index < destination_upstream->output_ports().size()); // NOLINT
         auto& destination_opposite = destination_upstream->output_ports()[output_index];
@@ -66,10 +69,30 @@ void graph_merger::repair_opposite(input_port_type const& source, input_port_typ
 }
 
 util::optional_ptr<graph_merger::node_type> graph_merger::find(graph_merger::node_type const& source) const noexcept {
-    if (auto it = mappings_.find(std::addressof(source)); it != mappings_.end()) {
-        return *it->second;
+    // the source element knows which graph owns it, so that we only check the segment of the graph
+    auto owner = source.optional_owner();
+    if (!owner) {
+        return {};
+    }
+    for (auto&& [g, offset] : segments_) {
+        if (g == owner.get()) {
+            if (auto ordinal = g->ordinal(source); ordinal != graph_type::npos) {
+                return *copies_[offset + ordinal];
+            }
+            break;
+        }
     }
     return {};
 }
 
+util::optional_ptr<graph_merger::node_type> graph_merger::find(
+        segment const& hint,
+        graph_merger::node_type const& source) const noexcept {
+    // the upstream is usually in the same graph
+    if (auto ordinal = hint.source->ordinal(source); ordinal != graph_type::npos) {
+        return *copies_[hint.offset + ordinal];
+    }
+    return find(source);
+}
+
 } // namespace takatori::relation::details
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <unordered_map>
+#include <vector>
 
 #include <takatori/relation/expression.h>
 #include <takatori/relation/graph.h>
@@ -14,12 +14,6 @@ public:
     using output_port_type = expression::output_port_type;
     using port_index_type = output_port_type::index_type;
     using graph_type = expression::graph_type;
-    using node_mapping_entry_type = std::pair<expression const* const, expression*>;
-    using node_mapping_type = std::unordered_map<
-            std::remove_const_t<node_mapping_entry_type::first_type>,
-            node_mapping_entry_type::second_type,
-            std::hash<std::remove_const_t<node_mapping_entry_type::first_type>>,
-            std::equal_to<>>;
 
     explicit graph_merger(graph_type& destination) noexcept;
 
@@ -31,16 +25,25 @@ public:
 
     graph_type& destination() const noexcept;
 
-    node_mapping_type const& mappings() const noexcept;
-
     util::optional_ptr<node_type> find(node_type const& source) const noexcept;
 
 private:
+    /**
+     * @brief a copied source graph.
+     * @details The copy of the source element whose ordinal is `i` is placed at `copies_[offset + i]`.
+     */
+    struct segment {
+        graph_type const* source;
+        std::size_t offset;
+    };
+
     graph_type& destination_;
-    node_mapping_type mappings_;
+    std::vector<segment> segments_ {};
+    std::vector<node_type*> copies_ {};
 
-    void repair_connections(node_type const& source, node_type& destination);
-    void repair_opposite(input_port_type const& source, input_port_type& destination) const;
+    void repair_connections(segment const& hint, node_type const& source, node_type& destination);
+    void repair_opposite(segment const& hint, input_port_type const& source, input_port_type& destination) const;
+    util::optional_ptr<node_type> find(segment const& hint, node_type const& source) const noexcept;
 };
 
 } // namespace takatori::relation::details
@@ -44,6 +44,14 @@ void expression::on_leave() noexcept {
     owner_ = nullptr;
 }
 
+std::size_t expression::graph_ordinal() const noexcept {
+    return graph_ordinal_;
+}
+
+void expression::graph_ordinal(std::size_t ordinal) noexcept {
+    graph_ordinal_ = ordinal;
+}
+
 bool operator==(expression const& a, expression const& b) noexcept {
     return a.equals(b);
 }
@@ -4,14 +4,12 @@
 #include <takatori/util/exception.h>
 #include <takatori/util/string_builder.h>
 
-#include <takatori/graph/topological_sort.h>
+#include <takatori/serializer/details/fingerprint_scanner.h>
 
 #include <takatori/relation/details/graph_merger.h>
 
 namespace takatori::relation {
 
-using ::takatori::graph::topological_sort;
-
 using ::takatori::util::throw_exception;
 using ::takatori::util::string_builder;
 
@@ -64,64 +62,6 @@ graph_type release(graph_type& source, util::sequence_view<expression const*> el
     return results;
 }
 
-namespace {
-
-template<class T>
-void upstreams0(T& expr, std::function<void(T&)> const& consumer) {
-    for (auto&& port : expr.input_ports()) {
-        if (auto opposite = port.opposite()) {
-            consumer(opposite->owner());
-        }
-    }
-}
-
-template<class T>
-void downstreams0(T& expr, std::function<void(T&)> const& consumer) {
-    for (auto&& port : expr.output_ports()) {
-        if (auto opposite = port.opposite()) {
-            consumer(opposite->owner());
-        }
-    }
-}
-
-template<class Graph, class Expr>
-void enumerate_top0(Graph& g, std::function<void(Expr&)> const& consumer) {
-    for (auto&& e : g) {
-        if (e.input_ports().empty()) {
-            consumer(e);
-        }
-    }
-}
-
-template<class Graph, class Expr>
-void enumerate_bottom0(Graph& g, std::function<void(Expr&)> const& consumer) {
-    for (auto&& e : g) {
-        if (e.output_ports().empty()) {
-            consumer(e);
-        }
-    }
-}
-
-struct upstream_enumerator {
-    void operator()(expression& expr, consumer_type const& consumer) const {
-        upstreams0(expr, consumer);
-    }
-    void operator()(expression const& expr, const_consumer_type const& consumer) const {
-        upstreams0(expr, consumer);
-    }
-};
-
-struct downstream_enumerator {
-    void operator()(expression& expr, consumer_type const& consumer) const {
-        downstreams0(expr, consumer);
-    }
-    void operator()(expression const& expr, const_consumer_type const& consumer) const {
-        downstreams0(expr, consumer);
-    }
-};
-
-} // namespace
-
 bool has_upstream(expression const& expr) {
     return !expr.input_ports().empty();
 }
@@ -131,51 +71,56 @@ bool has_downstream(expression const& expr) {
 }
 
 void enumerate_top(graph_type& g, consumer_type const& consumer) {
-    enumerate_top0(g, consumer);
+    enumerate_top<consumer_type const&>(g, consumer);
 }
 
 void enumerate_top(graph_type const& g, const_consumer_type const& consumer) {
-    enumerate_top0(g, consumer);
+    enumerate_top<const_consumer_type const&>(g, consumer);
 }
 
 void enumerate_bottom(graph_type& g, consumer_type const& consumer) {
-    enumerate_bottom0(g, consumer);
+    enumerate_bottom<consumer_type const&>(g, consumer);
 }
 
 void enumerate_bottom(graph_type const& g, const_consumer_type const& consumer) {
-    enumerate_bottom0(g, consumer);
+    enumerate_bottom<const_consumer_type const&>(g, consumer);
 }
 
 void enumerate_upstream(expression& expr, consumer_type const& consumer) {
-    upstreams0(expr, consumer);
+    enumerate_upstream<consumer_type const&>(expr, consumer);
 }
 
 void enumerate_upstream(expression const& expr, const_consumer_type const& consumer) {
-    upstreams0(expr, consumer);
+    enumerate_upstream<const_consumer_type const&>(expr, consumer);
 }
 
 void enumerate_downstream(expression& expr, consumer_type const& consumer) {
-    downstreams0(expr, consumer);
+    enumerate_downstream<consumer_type const&>(expr, consumer);
 }
 
 void enumerate_downstream(expression const& expr, const_consumer_type const& consumer) {
-    downstreams0(expr, consumer);
+    enumerate_downstream<const_consumer_type const&>(expr, consumer);
 }
 
 void sort_from_upstream(graph_type& g, consumer_type const& consumer) {
-    topological_sort<upstream_enumerator>(g, consumer);
+    sort_from_upstream<consumer_type const&>(g, consumer);
 }
 
 void sort_from_upstream(graph_type const& g, const_consumer_type const& consumer) {
-    topological_sort<upstream_enumerator>(g, consumer);
+    sort_from_upstream<const_consumer_type const&>(g, consumer);
 }
 
 void sort_from_downstream(graph_type& g, consumer_type const& consumer) {
-    topological_sort<downstream_enumerator>(g, consumer);
+    sort_from_downstream<consumer_type const&>(g, consumer);
 }
 
 void sort_from_downstream(graph_type const& g, const_consumer_type const& consumer) {
-    topological_sort<downstream_enumerator>(g, consumer);
+    sort_from_downstream<const_consumer_type const&>(g, consumer);
+}
+
+util::fingerprint compute_fingerprint(graph_type const& g, bool mask_literals) {
+    serializer::details::fingerprint_scanner scanner { mask_literals };
+    return scanner.fingerprint(g);
 }
 
 } // namespace takatori::relation
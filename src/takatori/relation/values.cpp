@@ -5,6 +5,7 @@
 
 #include <takatori/util/clonable.h>
 #include <takatori/util/downcast.h>
+#include <takatori/util/exception.h>
 #include <takatori/util/vector_print_support.h>
 
 namespace takatori::relation {
@@ -36,14 +37,18 @@ values::values(util::clone_tag_t, values const& other) :
             { other.columns_ },
             tree::forward(other.rows_),
     }
-{}
+{
+    block_ = other.block_;
+}
 
 values::values(util::clone_tag_t, values&& other) :
     values {
             { std::move(other.columns_) },
             tree::forward(std::move(other.rows_)),
     }
-{}
+{
+    block_ = std::move(other.block_);
+}
 
 expression_kind values::kind() const noexcept {
     return tag;
@@ -98,9 +103,40 @@ tree::tree_fragment_vector<values::row> const& values::rows() const noexcept {
     return rows_;
 }
 
+util::optional_ptr<scalar::literal_block const> values::block() const noexcept {
+    return util::optional_ptr { block_.get() };
+}
+
+values& values::block(std::shared_ptr<scalar::literal_block const> block) {
+    if (block && block->columns().size() != columns_.size()) {
+        util::throw_exception(std::invalid_argument("inconsistent number of block columns"));
+    }
+    block_ = std::move(block);
+    return *this;
+}
+
+values& values::materialize_block() {
+    if (!block_) {
+        return *this;
+    }
+    auto&& columns = block_->columns();
+    rows_.reserve(rows_.size() + block_->row_count());
+    for (std::size_t r = 0, n = block_->row_count(); r < n; ++r) {
+        util::reference_vector<scalar::expression> elements {};
+        elements.reserve(columns.size());
+        for (std::size_t c = 0, m = columns.size(); c < m; ++c) {
+            elements.push_back(block_->materialize(r, c));
+        }
+        rows_.emplace_back(std::move(elements));
+    }
+    block_.reset();
+    return *this;
+}
+
 bool operator==(values const& a, values const& b) noexcept {
     return a.columns() == b.columns()
-        && a.rows() == b.rows();
+        && a.rows() == b.rows()
+        && a.block() == b.block();
 }
 
 bool operator!=(values const& a, values const& b) noexcept {
@@ -108,9 +144,13 @@ bool operator!=(values const& a, values const& b) noexcept {
 }
 
 std::ostream& operator<<(std::ostream& out, values const& value) {
-    return out << value.kind() << "("
-               << "columns=" << util::print_support { value.columns() } << ", "
-               << "rows=" << value.rows() << ")";
+    out << value.kind() << "("
+        << "columns=" << util::print_support { value.columns() } << ", "
+        << "rows=" << value.rows();
+    if (auto block = value.block()) {
+        out << ", block=" << *block;
+    }
+    return out << ")";
 }
 
 bool values::equals(expression const& other) const noexcept {
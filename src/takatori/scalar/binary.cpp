@@ -59,6 +59,7 @@ binary::operator_kind_type binary::operator_kind() const noexcept {
 
 binary& binary::operator_kind(binary::operator_kind_type operator_kind) noexcept {
     operator_kind_ = operator_kind;
+    invalidate_fingerprint();
     return *this;
 }
 
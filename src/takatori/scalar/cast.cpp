@@ -65,6 +65,7 @@ std::shared_ptr<type::data const> cast::shared_type() const noexcept {
 
 cast& cast::type(std::shared_ptr<type::data const> type) noexcept {
     type_ = std::move(type);
+    invalidate_fingerprint();
     return *this;
 }
 
@@ -74,6 +75,7 @@ cast::loss_policy_type cast::loss_policy() const noexcept {
 
 cast& cast::loss_policy(cast::loss_policy_type loss_policy) noexcept {
     loss_policy_ = loss_policy;
+    invalidate_fingerprint();
     return *this;
 }
 
@@ -59,6 +59,7 @@ compare::operator_kind_type compare::operator_kind() const noexcept {
 
 compare& compare::operator_kind(compare::operator_kind_type operator_kind) noexcept {
     operator_kind_ = operator_kind;
+    invalidate_fingerprint();
     return *this;
 }
 
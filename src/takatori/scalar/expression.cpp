@@ -1,9 +1,112 @@
 #include <takatori/scalar/expression.h>
 
+#include <vector>
+
+#include <takatori/scalar/walk.h>
+
 #include <takatori/util/downcast.h>
 
 namespace takatori::scalar {
 
+/**
+ * @private
+ * @brief computes fingerprint of expressions, and caches them into the individual expressions.
+ */
+class fingerprint_engine {
+public:
+    bool operator()(expression const& expr) {
+        if (util::fingerprint cached {}; expr.find_fingerprint(cached)) {
+            results_.push_back(cached);
+            return false;
+        }
+        offsets_.push_back(results_.size());
+        return true;
+    }
+
+    template<class T>
+    void operator()(util::post_visit, T const& expr) {
+        auto offset = offsets_.back();
+        offsets_.pop_back();
+
+        util::fingerprint_builder builder {};
+        builder.add(static_cast<std::uint64_t>(expr.kind()));
+        add_properties(builder, expr);
+        builder.add(static_cast<std::uint64_t>(results_.size() - offset));
+        for (auto iter = results_.begin() + static_cast<std::ptrdiff_t>(offset); iter != results_.end(); ++iter) {
+            builder.add(*iter);
+        }
+        results_.resize(offset);
+
+        auto result = builder.build();
+        expr.cache_fingerprint(result);
+        results_.push_back(result);
+    }
+
+    [[nodiscard]] util::fingerprint result() const noexcept {
+        return results_.back();
+    }
+
+private:
+    std::vector<util::fingerprint> results_ {};
+    std::vector<std::size_t> offsets_ {};
+
+    template<class T>
+    static std::uint64_t hash(T const& value) noexcept {
+        return static_cast<std::uint64_t>(std::hash<T> {}(value));
+    }
+
+    static void add_properties(util::fingerprint_builder&, expression const&) noexcept {}
+
+    static void add_properties(util::fingerprint_builder& builder, immediate const& expr) noexcept {
+        builder.add(hash(expr.optional_value()));
+        builder.add(hash(expr.optional_type()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, variable_reference const& expr) noexcept {
+        builder.add(hash(expr.variable()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, unary const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.operator_kind()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, cast const& expr) noexcept {
+        builder.add(hash(expr.optional_type()));
+        builder.add(static_cast<std::uint64_t>(expr.loss_policy()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, binary const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.operator_kind()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, compare const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.operator_kind()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, match const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.operator_kind()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, conditional const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.alternatives().size()));
+        builder.add(static_cast<std::uint64_t>(expr.default_expression() ? 1 : 0));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, let const& expr) noexcept {
+        for (auto&& declarator : expr.variables()) {
+            builder.add(hash(declarator.variable()));
+        }
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, function_call const& expr) noexcept {
+        builder.add(hash(expr.function()));
+    }
+
+    static void add_properties(util::fingerprint_builder& builder, extension const& expr) noexcept {
+        builder.add(static_cast<std::uint64_t>(expr.extension_id()));
+    }
+};
+
 expression::parent_type* expression::parent_element() noexcept {
     return parent_;
 }
@@ -13,7 +116,16 @@ expression::parent_type const* expression::parent_element() const noexcept {
 }
 
 void expression::parent_element(expression::parent_type* parent) noexcept {
-    parent_ = parent;
+    if (parent_ != parent) {
+        // detached from the current parent
+        if (auto current = parent_expression()) {
+            current->invalidate_fingerprint();
+        }
+        parent_ = parent;
+    }
+    if (auto current = parent_expression()) {
+        current->invalidate_fingerprint();
+    }
 }
 
 util::optional_ptr<expression> expression::parent_expression() noexcept {
@@ -32,6 +144,41 @@ document::region const& expression::region() const noexcept {
     return region_;
 }
 
+util::fingerprint expression::fingerprint() const {
+    if (util::fingerprint cached {}; find_fingerprint(cached)) {
+        return cached;
+    }
+    fingerprint_engine engine {};
+    walk(engine, *this);
+    return engine.result();
+}
+
+void expression::invalidate_fingerprint() noexcept {
+    // if an expression does not have its fingerprint, its ancestors also do not have
+    for (auto* current = this;
+            current != nullptr && current->fingerprint_cached_.exchange(false, std::memory_order_relaxed);
+            current = current->parent_expression().get()) {
+        // continue
+    }
+}
+
+bool expression::find_fingerprint(util::fingerprint& result) const noexcept {
+    if (!fingerprint_cached_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    result = util::fingerprint {
+            fingerprint_high_.load(std::memory_order_relaxed),
+            fingerprint_low_.load(std::memory_order_relaxed),
+    };
+    return true;
+}
+
+void expression::cache_fingerprint(util::fingerprint value) const noexcept {
+    fingerprint_high_.store(value.high(), std::memory_order_relaxed);
+    fingerprint_low_.store(value.low(), std::memory_order_relaxed);
+    fingerprint_cached_.store(true, std::memory_order_release);
+}
+
 bool operator==(expression const& a, expression const& b) noexcept {
     return a.equals(b);
 }
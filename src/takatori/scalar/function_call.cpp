@@ -45,6 +45,8 @@ function_call* function_call::clone() && {
 }
 
 descriptor::function& function_call::function() noexcept {
+    // may be modified via the returned reference
+    invalidate_fingerprint();
     return function_;
 }
 
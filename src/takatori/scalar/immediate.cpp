@@ -52,6 +52,7 @@ std::shared_ptr<value::data const> immediate::shared_value() const noexcept {
 
 immediate& immediate::value(std::shared_ptr<value::data const> value) noexcept {
     value_ = std::move(value);
+    invalidate_fingerprint();
     return *this;
 }
 
@@ -69,6 +70,7 @@ std::shared_ptr<type::data const> immediate::shared_type() const noexcept {
 
 immediate& immediate::type(std::shared_ptr<type::data const> type) noexcept {
     type_ = std::move(type);
+    invalidate_fingerprint();
     return *this;
 }
 
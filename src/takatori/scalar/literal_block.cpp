@@ -0,0 +1,380 @@
+#include <takatori/scalar/literal_block.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include <cstdlib>
+
+
+#include <takatori/util/clonable.h>
+#include <takatori/util/exception.h>
+#include <takatori/util/object_memory.h>
+
+namespace takatori::scalar {
+
+using column = literal_block::column;
+
+namespace {
+
+template<class T>
+constexpr std::size_t fixed_stride = sizeof(typename T::entity_type);
+
+std::size_t stride_of(value::value_kind kind, std::size_t varlen) noexcept {
+    using k = value::value_kind;
+    switch (kind) {
+        case k::boolean: return fixed_stride<value::boolean>;
+        case k::int4: return fixed_stride<value::int4>;
+        case k::int8: return fixed_stride<value::int8>;
+        case k::float4: return fixed_stride<value::float4>;
+        case k::float8: return fixed_stride<value::float8>;
+        case k::decimal: return fixed_stride<value::decimal>;
+        case k::date: return fixed_stride<value::date>;
+        case k::time_of_day: return fixed_stride<value::time_of_day>;
+        case k::time_point: return fixed_stride<value::time_point>;
+        case k::datetime_interval: return fixed_stride<value::datetime_interval>;
+        default: return varlen;
+    }
+}
+
+template<class Boxed>
+auto boxed_iterator(Boxed const& boxed, std::size_t row) noexcept {
+    return std::lower_bound(
+            boxed.begin(),
+            boxed.end(),
+            row,
+            [](auto const& entry, std::size_t r) { return entry.first < r; });
+}
+
+} // namespace
+
+column::column(std::shared_ptr<type::data const> type) noexcept :
+    type_ { std::move(type) }
+{}
+
+type::data const& column::type() const noexcept {
+    return *type_;
+}
+
+std::shared_ptr<type::data const> const& column::shared_type() const noexcept {
+    return type_;
+}
+
+column::size_type column::size() const noexcept {
+    return states_.size();
+}
+
+std::optional<value::value_kind> column::packed_kind() const noexcept {
+    return packed_kind_;
+}
+
+value::value_kind column::kind(size_type row) const {
+    switch (state_at(row)) {
+        case cell_state::null: return value::value_kind::unknown;
+        case cell_state::packed: return *packed_kind_;
+        case cell_state::boxed: return boxed_at(row).kind();
+    }
+    std::abort();
+}
+
+bool column::is_null(size_type row) const {
+    return state_at(row) == cell_state::null;
+}
+
+std::shared_ptr<value::data const> column::value(size_type row) const {
+    switch (state_at(row)) {
+        case cell_state::null:
+            return util::make_shared_object<value::unknown>(value::unknown_kind::null);
+        case cell_state::boxed:
+            return boxed_iterator(boxed_, row)->second;
+        case cell_state::packed:
+            break;
+    }
+    using k = value::value_kind;
+    switch (*packed_kind_) {
+        case k::boolean: return unpack<value::boolean>(row);
+        case k::int4: return unpack<value::int4>(row);
+        case k::int8: return unpack<value::int8>(row);
+        case k::float4: return unpack<value::float4>(row);
+        case k::float8: return unpack<value::float8>(row);
+        case k::decimal: return unpack<value::decimal>(row);
+        case k::character: return unpack<value::character>(row);
+        case k::octet: return unpack<value::octet>(row);
+        case k::date: return unpack<value::date>(row);
+        case k::time_of_day: return unpack<value::time_of_day>(row);
+        case k::time_point: return unpack<value::time_point>(row);
+        case k::datetime_interval: return unpack<value::datetime_interval>(row);
+        default: break;
+    }
+    std::abort();
+}
+
+void column::append(value::data const& value) {
+    if (value.kind() == value::value_kind::unknown
+            && util::unsafe_downcast<value::unknown>(value).get() == value::unknown_kind::null) {
+        append_null();
+        return;
+    }
+    if (!packed_kind_ && (is_fixed(value.kind()) || is_variable(value.kind()))) {
+        packed_kind_ = value.kind();
+        stride_ = stride_of(value.kind(), sizeof(varlen_slot));
+        // backfill slots of the preceding nulls
+        slots_.resize(states_.size() * stride_);
+    }
+    if (packed_kind_ == value.kind()) {
+        pack(value);
+        return;
+    }
+    boxed_.emplace_back(states_.size(), util::clone_shared(value));
+    states_.emplace_back(cell_state::boxed);
+    slots_.resize(states_.size() * stride_);
+}
+
+void column::append_null() {
+    states_.emplace_back(cell_state::null);
+    slots_.resize(states_.size() * stride_);
+}
+
+void column::reserve(size_type size) {
+    states_.reserve(size);
+    if (stride_ > 0) {
+        slots_.reserve(size * stride_);
+    }
+}
+
+void column::truncate(size_type rows) noexcept {
+    // NOTE: only used for removing the last incomplete row, so that the rows are already packed or boxed
+    if (states_.size() > rows) {
+        states_.erase(states_.begin() + static_cast<std::ptrdiff_t>(rows), states_.end());
+    }
+    while (!boxed_.empty() && boxed_.back().first >= rows) {
+        boxed_.pop_back();
+    }
+    auto last_packed = std::find(states_.rbegin(), states_.rend(), cell_state::packed);
+    if (last_packed == states_.rend()) {
+        // the removed cell may decide the packed kind
+        packed_kind_.reset();
+        stride_ = 0;
+        slots_.clear();
+        arena_.clear();
+        return;
+    }
+    if (slots_.size() > rows * stride_) {
+        slots_.erase(slots_.begin() + static_cast<std::ptrdiff_t>(rows * stride_), slots_.end());
+    }
+    if (is_variable(*packed_kind_)) {
+        auto row = static_cast<size_type>(std::distance(last_packed, states_.rend())) - 1;
+        varlen_slot entry {};
+        std::memcpy(std::addressof(entry), slot(row), sizeof(entry));
+        arena_.erase(entry.offset + entry.size);
+    }
+}
+
+column::cell_state column::state_at(size_type row) const {
+    if (row >= states_.size()) {
+        util::throw_exception(std::out_of_range("row is out of range"));
+    }
+    return states_[row];
+}
+
+std::byte const* column::slot(size_type row) const noexcept {
+    return slots_.data() + row * stride_; // NOLINT
+}
+
+value::data const& column::boxed_at(size_type row) const noexcept {
+    return *boxed_iterator(boxed_, row)->second;
+}
+
+void column::pack(value::data const& value) {
+    using k = value::value_kind;
+    switch (value.kind()) {
+        case k::boolean: pack_fixed<value::boolean>(value); return;
+        case k::int4: pack_fixed<value::int4>(value); return;
+        case k::int8: pack_fixed<value::int8>(value); return;
+        case k::float4: pack_fixed<value::float4>(value); return;
+        case k::float8: pack_fixed<value::float8>(value); return;
+        case k::decimal: pack_fixed<value::decimal>(value); return;
+        case k::character: pack_variable<value::character>(value); return;
+        case k::octet: pack_variable<value::octet>(value); return;
+        case k::date: pack_fixed<value::date>(value); return;
+        case k::time_of_day: pack_fixed<value::time_of_day>(value); return;
+        case k::time_point: pack_fixed<value::time_point>(value); return;
+        case k::datetime_interval: pack_fixed<value::datetime_interval>(value); return;
+        default: break;
+    }
+    std::abort();
+}
+
+template<class T>
+void column::pack_fixed(value::data const& value) {
+    using entity_type = typename T::entity_type;
+    static_assert(std::is_trivially_copyable_v<entity_type>);
+    entity_type entity = util::unsafe_downcast<T>(value).get();
+    auto offset = slots_.size();
+    slots_.resize(offset + stride_);
+    std::memcpy(slots_.data() + offset, std::addressof(entity), sizeof(entity)); // NOLINT
+    states_.emplace_back(cell_state::packed);
+}
+
+template<class T>
+void column::pack_variable(value::data const& value) {
+    auto entity = util::unsafe_downcast<T>(value).get();
+    varlen_slot entry { arena_.size(), entity.size() };
+    arena_.append(entity);
+    auto offset = slots_.size();
+    slots_.resize(offset + stride_);
+    std::memcpy(slots_.data() + offset, std::addressof(entry), sizeof(entry)); // NOLINT
+    states_.emplace_back(cell_state::packed);
+}
+
+template<class T>
+std::shared_ptr<value::data const> column::unpack(size_type row) const {
+    return util::make_shared_object<T>(typename T::entity_type { get<T::tag>(row) });
+}
+
+bool column::cell_equals(column const& a, column const& b, size_type row) noexcept {
+    auto sa = a.states_[row];
+    auto sb = b.states_[row];
+    if (sa == cell_state::null || sb == cell_state::null) {
+        return sa == sb;
+    }
+    if (sa == cell_state::boxed && sb == cell_state::boxed) {
+        return a.boxed_at(row) == b.boxed_at(row);
+    }
+    auto ka = sa == cell_state::packed ? *a.packed_kind_ : a.boxed_at(row).kind();
+    auto kb = sb == cell_state::packed ? *b.packed_kind_ : b.boxed_at(row).kind();
+    if (ka != kb) {
+        return false;
+    }
+    // compares the packed contents directly, without creating value objects
+    using k = value::value_kind;
+    switch (ka) {
+        case k::boolean: return a.view_at<k::boolean>(row) == b.view_at<k::boolean>(row);
+        case k::int4: return a.view_at<k::int4>(row) == b.view_at<k::int4>(row);
+        case k::int8: return a.view_at<k::int8>(row) == b.view_at<k::int8>(row);
+        case k::float4: return a.view_at<k::float4>(row) == b.view_at<k::float4>(row);
+        case k::float8: return a.view_at<k::float8>(row) == b.view_at<k::float8>(row);
+        case k::decimal: return a.view_at<k::decimal>(row) == b.view_at<k::decimal>(row);
+        case k::character: return a.view_at<k::character>(row) == b.view_at<k::character>(row);
+        case k::octet: return a.view_at<k::octet>(row) == b.view_at<k::octet>(row);
+        case k::date: return a.view_at<k::date>(row) == b.view_at<k::date>(row);
+        case k::time_of_day: return a.view_at<k::time_of_day>(row) == b.view_at<k::time_of_day>(row);
+        case k::time_point: return a.view_at<k::time_point>(row) == b.view_at<k::time_point>(row);
+        case k::datetime_interval:
+            return a.view_at<k::datetime_interval>(row) == b.view_at<k::datetime_interval>(row);
+        default: break;
+    }
+    std::abort();
+}
+
+bool operator==(column const& a, column const& b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    if (a.type_ != b.type_ && (!a.type_ || !b.type_ || *a.type_ != *b.type_)) {
+        return false;
+    }
+    for (column::size_type row = 0, n = a.size(); row < n; ++row) {
+        if (!column::cell_equals(a, b, row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool operator!=(column const& a, column const& b) noexcept {
+    return !(a == b);
+}
+
+literal_block::literal_block(std::vector<std::shared_ptr<type::data const>> types) {
+    columns_.reserve(types.size());
+    for (auto&& type : types) {
+        columns_.emplace_back(std::move(type));
+    }
+}
+
+std::vector<literal_block::column> const& literal_block::columns() const noexcept {
+    return columns_;
+}
+
+literal_block::size_type literal_block::row_count() const noexcept {
+    if (columns_.empty()) {
+        return 0;
+    }
+    return columns_.front().size();
+}
+
+void literal_block::reserve(size_type rows) {
+    for (auto&& column : columns_) {
+        column.reserve(rows);
+    }
+}
+
+literal_block& literal_block::add_row(std::vector<value::data const*> const& values) {
+    if (values.size() != columns_.size()) {
+        util::throw_exception(std::invalid_argument("inconsistent number of values"));
+    }
+    auto rows = row_count();
+    try {
+        for (size_type index = 0, n = values.size(); index < n; ++index) {
+            if (auto const* value = values[index]; value != nullptr) {
+                columns_[index].append(*value);
+            } else {
+                columns_[index].append_null();
+            }
+        }
+    } catch (...) {
+        rollback(rows);
+        throw;
+    }
+    return *this;
+}
+
+void literal_block::rollback(size_type rows) noexcept {
+    for (auto&& column : columns_) {
+        column.truncate(rows);
+    }
+}
+
+std::unique_ptr<immediate> literal_block::materialize(size_type row, size_type column) const {
+    if (column >= columns_.size()) {
+        util::throw_exception(std::out_of_range("column is out of range"));
+    }
+    auto&& c = columns_[column];
+    return std::make_unique<immediate>(c.value(row), c.shared_type());
+}
+
+bool operator==(literal_block const& a, literal_block const& b) noexcept {
+    return a.columns_ == b.columns_;
+}
+
+bool operator!=(literal_block const& a, literal_block const& b) noexcept {
+    return !(a == b);
+}
+
+std::ostream& operator<<(std::ostream& out, literal_block const& value) {
+    out << "literal_block(types=[";
+    for (auto iter = value.columns_.begin(); iter != value.columns_.end(); ++iter) {
+        if (iter != value.columns_.begin()) {
+            out << ", ";
+        }
+        out << iter->type();
+    }
+    out << "], rows=[";
+    for (literal_block::size_type row = 0, n = value.row_count(); row < n; ++row) {
+        if (row > 0) {
+            out << ", ";
+        }
+        out << "[";
+        for (auto iter = value.columns_.begin(); iter != value.columns_.end(); ++iter) {
+            if (iter != value.columns_.begin()) {
+                out << ", ";
+            }
+            out << *iter->value(row);
+        }
+        out << "]";
+    }
+    return out << "])";
+}
+
+} // namespace takatori::scalar
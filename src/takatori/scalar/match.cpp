@@ -65,6 +65,7 @@ match::operator_kind_type match::operator_kind() const noexcept {
 
 match& match::operator_kind(match::operator_kind_type operator_kind) noexcept {
     operator_kind_ = operator_kind;
+    invalidate_fingerprint();
     return *this;
 }
 
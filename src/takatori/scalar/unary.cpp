@@ -53,6 +53,7 @@ unary::operator_kind_type unary::operator_kind() const noexcept {
 
 unary& unary::operator_kind(unary::operator_kind_type operator_kind) noexcept {
     operator_kind_ = operator_kind;
+    invalidate_fingerprint();
     return *this;
 }
 
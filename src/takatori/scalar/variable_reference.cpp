@@ -29,6 +29,8 @@ variable_reference* variable_reference::clone() && {
 }
 
 descriptor::variable& variable_reference::variable() noexcept {
+    // may be modified via the returned reference
+    invalidate_fingerprint();
     return variable_;
 }
 
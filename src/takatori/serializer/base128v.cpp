@@ -2,57 +2,135 @@
 
 #include <cstring>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 namespace takatori::serializer::base128v {
 
-bool write_unsigned(
-        std::uint64_t value,
-        util::buffer_view::iterator& iterator,
-        util::buffer_view::const_iterator end) noexcept {
-    using value_type = util::buffer_view::value_type;
-    auto value_work = value;
-    auto iter_work = iterator; // NOLINT(readability-qualified-auto)
-    for (std::uint64_t i = 0; i < 8; ++i) {
-        if (iter_work == end) {
-            return false;
-        }
+using util::details::count_trailing_zeros;
+using util::details::lower_mask;
 
-        // the 1st ~ 8th groups have continue bit.
-        // cvvv vvvv
-        //   c - continue bit
-        //   v - 7-bit value block
-        auto group_value = value_work & 0x7fULL;
+/*
+ * The 1st ~ 8th groups have continue bit, and the 9th group has no continue bit:
+ *   cvvv vvvv (1st ~ 8th)
+ *   vvvv vvvv (9th)
+ *     c - continue bit
+ *     v - value block
+ *
+ * Because the groups are ordered as little-endian, the first 8 groups can be processed at once as a 64-bit word:
+ * the 7-bit value blocks are scattered to (or gathered from) the lower 7-bits of individual octets,
+ * and the continue bits are just the upper bits of individual octets.
+ */
 
-        // shift out the current group
-        value_work >>= 7ULL;
+static constexpr bool little_endian =
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+        __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+        false;
+#endif
 
-        // check the rest bits
-        if (value_work == 0) {
-            // no more value bits
-            *iter_work = static_cast<value_type>(group_value);
-            ++iter_work;
-            iterator = iter_work;
-            return true;
+static constexpr std::uint64_t value_bits = 0x7f7f'7f7f'7f7f'7f7fULL;
+
+static constexpr std::uint64_t continue_bits = 0x8080'8080'8080'8080ULL;
+
+// scatters the lower 56-bits of value into the lower 7-bits of individual octets
+static inline std::uint64_t scatter_groups(std::uint64_t value) noexcept {
+#if defined(__BMI2__)
+    return _pdep_u64(value, value_bits);
+#else
+    auto work = value & lower_mask<std::uint64_t>(56);
+    work = (work & 0x0000'0000'0fff'ffffULL) | ((work & 0x00ff'ffff'f000'0000ULL) << 4U);
+    work = (work & 0x0000'3fff'0000'3fffULL) | ((work & 0x0fff'c000'0fff'c000ULL) << 2U);
+    work = (work & 0x007f'007f'007f'007fULL) | ((work & 0x3f80'3f80'3f80'3f80ULL) << 1U);
+    return work;
+#endif
+}
+
+// gathers the lower 7-bits of individual octets into the lower 56-bits
+static inline std::uint64_t gather_groups(std::uint64_t word) noexcept {
+#if defined(__BMI2__)
+    return _pext_u64(word, value_bits);
+#else
+    auto work = word & value_bits;
+    work = (work & 0x007f'007f'007f'007fULL) | ((work & 0x7f00'7f00'7f00'7f00ULL) >> 1U);
+    work = (work & 0x0000'3fff'0000'3fffULL) | ((work & 0x3fff'0000'3fff'0000ULL) >> 2U);
+    work = (work & 0x0000'0000'0fff'ffffULL) | ((work & 0x0fff'ffff'0000'0000ULL) >> 4U);
+    return work;
+#endif
+}
+
+template<class T>
+static inline void store_fixed(std::uint64_t word, util::buffer_view::iterator iterator) noexcept {
+    auto value = static_cast<T>(word);
+    std::memcpy(&*iterator, &value, sizeof(value));
+}
+
+// stores just the lower `size` octets, by using two fixed size stores which may overlap each other
+static inline void store_word(std::uint64_t word, std::size_t size, util::buffer_view::iterator iterator) noexcept {
+    if constexpr (little_endian) { // NOLINT(bugprone-branch-clone)
+        if (size >= 4) {
+            if (size == 8) {
+                store_fixed<std::uint64_t>(word, iterator);
+                return;
+            }
+            store_fixed<std::uint32_t>(word, iterator);
+            store_fixed<std::uint32_t>(word >> ((size - 4) * 8U), iterator + (size - 4));
+        } else if (size >= 2) {
+            store_fixed<std::uint16_t>(word, iterator);
+            store_fixed<std::uint16_t>(word >> ((size - 2) * 8U), iterator + (size - 2));
+        } else {
+            store_fixed<std::uint8_t>(word, iterator);
         }
+    } else {
+        for (std::size_t i = 0; i < size; ++i) {
+            iterator[i] = static_cast<util::buffer_view::value_type>(word >> (i * 8U)); // NOLINT
+        }
+    }
+}
 
-        // more value bits are rest
-        *iter_work = static_cast<value_type>(0x80ULL | group_value);
-        ++iter_work;
+static inline std::uint64_t load_word(util::buffer_view::const_iterator iterator) noexcept {
+    std::uint64_t word {};
+    if constexpr (little_endian) { // NOLINT(bugprone-branch-clone)
+        std::memcpy(&word, &*iterator, sizeof(word));
+    } else {
+        for (std::size_t i = 0; i < sizeof(word); ++i) {
+            word |= std::uint64_t { static_cast<unsigned char>(iterator[i]) } << (i * 8U); // NOLINT
+        }
     }
-    if (iter_work == end) {
+    return word;
+}
+
+static inline bool impl_write_unsigned(
+        std::uint64_t value,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept {
+    auto size = size_unsigned(value);
+    if (std::distance<util::buffer_view::const_iterator>(iterator, end) < static_cast<std::ptrdiff_t>(size)) {
         return false;
     }
-
-    // the 9th group has no continue bit.
-    // vvvv vvvv
-    //   v - 8-bit value block
-    *iter_work = static_cast<value_type>(value_work & 0xffULL);
-    ++iter_work;
-    iterator = iter_work;
+    auto word = scatter_groups(value);
+    if (size <= 8) {
+        // continue bits of the all groups except the last one
+        word |= continue_bits & lower_mask<std::uint64_t>((size - 1) * 8U);
+        store_word(word, size, iterator);
+    } else {
+        store_word(word | continue_bits, 8, iterator);
+        iterator[8] = static_cast<util::buffer_view::value_type>(value >> 56U); // NOLINT
+    }
+    iterator += size;
     return true;
 }
 
+bool write_unsigned(
+        std::uint64_t value,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept {
+    return impl_write_unsigned(value, iterator, end);
+}
+
 template<class Iter>
-static std::optional<std::uint64_t> impl_read_unsigned(
+static std::optional<std::uint64_t> impl_read_unsigned_slow(
         Iter& iterator,
         util::buffer_view::const_iterator end) noexcept {
     std::uint64_t result {};
@@ -68,14 +146,9 @@ static std::optional<std::uint64_t> impl_read_unsigned(
         }
         ++iter_work;
 
-        // the 1st ~ 8th groups have continue bit.
-        // cvvv vvvv
-        //   c - continue bit
-        //   v - 7-bit value block
         result |= (group & 0x7fULL) << (i * 7);
         if ((group & 0x80ULL) == 0) {
             // end of sequence
-            result |= (group & 0x7fULL) << (i * 7);
             iterator = iter_work;
             return { result };
         }
@@ -92,14 +165,47 @@ static std::optional<std::uint64_t> impl_read_unsigned(
     }
     ++iter_work;
 
-    // the 9th group has no continue bit.
-    // vvvv vvvv
-    //   v - 8-bit value block
     result |= (group & 0xffULL) << 56ULL;
     iterator = iter_work;
     return { result };
 }
 
+template<class Iter>
+static inline std::optional<std::uint64_t> impl_read_unsigned(
+        Iter& iterator,
+        util::buffer_view::const_iterator end) noexcept {
+    if (std::distance<util::buffer_view::const_iterator>(iterator, end) < 8) {
+        return impl_read_unsigned_slow(iterator, end);
+    }
+    auto word = load_word(iterator);
+
+    // the last group is the first one without continue bit
+    if (auto stops = ~word & continue_bits; stops != 0) {
+        auto last = count_trailing_zeros(stops) / 8U;
+        auto last_group = (word >> (last * 8U)) & 0xffULL;
+        if (last != 0 && last_group == 0) {
+            // for strict, all zeros group is not allowed, except just represents 0
+            return std::nullopt;
+        }
+        auto result = gather_groups(word & lower_mask<std::uint64_t>((last + 1) * 8U));
+        iterator += last + 1;
+        return { result };
+    }
+
+    // the 9th group is required
+    if (std::distance<util::buffer_view::const_iterator>(iterator, end) < 9) {
+        return std::nullopt;
+    }
+    auto group = static_cast<std::uint64_t>(static_cast<unsigned char>(iterator[8])); // NOLINT
+    if (group == 0) {
+        // for strict, all zeros group is not allowed
+        return std::nullopt;
+    }
+    auto result = gather_groups(word) | (group << 56U);
+    iterator += 9;
+    return { result };
+}
+
 std::optional<std::uint64_t> read_unsigned(
         util::buffer_view::iterator& iterator,
         util::buffer_view::const_iterator end) noexcept {
@@ -112,22 +218,15 @@ std::optional<std::uint64_t> read_unsigned(
     return impl_read_unsigned(iterator, end);
 }
 
-static std::uint64_t encode_signed(std::int64_t value) {
+static std::uint64_t encode_signed(std::int64_t value) noexcept {
     std::uint64_t work {};
     std::memcpy(&work, &value, sizeof(value));
-    work <<= 1ULL;
-    if (value < 0) {
-        work = ~work;
-    }
-    return work;
+    // moves the sign bit to LSB, and inverts the rest bits if negative
+    return (work << 1ULL) ^ (0ULL - (work >> 63ULL));
 }
 
-static std::int64_t decode_signed(std::uint64_t encoded) {
-    std::uint64_t work = encoded;
-    work >>= 1ULL;
-    if ((encoded & 0x01ULL) != 0) {
-        work = ~work;
-    }
+static std::int64_t decode_signed(std::uint64_t encoded) noexcept {
+    std::uint64_t work = (encoded >> 1ULL) ^ (0ULL - (encoded & 0x01ULL));
     std::int64_t result {};
     std::memcpy(&result, &work, sizeof(work));
     return result;
@@ -141,7 +240,7 @@ bool write_signed(
         std::int64_t value,
         util::buffer_view::iterator& iterator,
         util::buffer_view::const_iterator end) {
-    return write_unsigned(encode_signed(value), iterator, end);
+    return impl_write_unsigned(encode_signed(value), iterator, end);
 }
 
 std::optional<std::int64_t> read_signed(
@@ -162,4 +261,64 @@ std::optional<std::int64_t> read_signed(
     return std::nullopt;
 }
 
+size_type write_unsigned_values(
+        util::sequence_view<std::uint64_t const> values,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept {
+    size_type count = 0;
+    for (auto value : values) {
+        if (!impl_write_unsigned(value, iterator, end)) {
+            break;
+        }
+        ++count;
+    }
+    return count;
+}
+
+size_type read_unsigned_values(
+        util::buffer_view::const_iterator& iterator,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::uint64_t> destination) noexcept {
+    size_type count = 0;
+    for (auto& value : destination) {
+        auto result = impl_read_unsigned(iterator, end);
+        if (!result) {
+            break;
+        }
+        value = *result;
+        ++count;
+    }
+    return count;
+}
+
+size_type write_signed_values(
+        util::sequence_view<std::int64_t const> values,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept {
+    size_type count = 0;
+    for (auto value : values) {
+        if (!impl_write_unsigned(encode_signed(value), iterator, end)) {
+            break;
+        }
+        ++count;
+    }
+    return count;
+}
+
+size_type read_signed_values(
+        util::buffer_view::const_iterator& iterator,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::int64_t> destination) noexcept {
+    size_type count = 0;
+    for (auto& value : destination) {
+        auto result = impl_read_unsigned(iterator, end);
+        if (!result) {
+            break;
+        }
+        value = decode_signed(*result);
+        ++count;
+    }
+    return count;
+}
+
 }  // namespace takatori::serializer::base128v
@@ -5,6 +5,8 @@
 #include <cstdint>
 
 #include <takatori/util/buffer_view.h>
+#include <takatori/util/sequence_view.h>
+#include <takatori/util/details/bit_operations.h>
 
 /**
  * @brief serialize/deserialize integers using base128 variant.
@@ -24,12 +26,9 @@ using size_type = std::size_t;
  * @return the encoded size in bytes
  */
 [[nodiscard]] constexpr size_type size_unsigned(std::uint64_t value) noexcept {
-    for (std::uint64_t i = 1; i <= 8; ++i) {
-        if (value < (1ULL << (i * 7))) {
-            return i;
-        }
-    }
-    return 9;
+    // ceil(significant_bits / 7), where 0 has 1 significant bit, and the 9th group holds 8 bits
+    auto size = (70U - util::details::count_leading_zeros(value | 1U)) / 7U;
+    return size < 9U ? size : 9U;
 }
 
 /**
@@ -86,4 +85,49 @@ std::optional<std::int64_t> read_signed(
         util::buffer_view::const_iterator& iterator,
         util::buffer_view::const_iterator end);
 
+/**
+ * @brief writes a series of values as base128 variant into the buffer.
+ * @details
+ *      This advances the `iterator` argument to the next of the last written value.
+ *      This stops writing values if the remaining buffer is not enough.
+ *      This is equivalent to calling write_unsigned() for each value, but is faster for a large number of values.
+ * @param values the values to write
+ * @param iterator [INOUT] the buffer iterator
+ * @param end  the buffer limit
+ * @return the number of written values
+ */
+size_type write_unsigned_values(
+        util::sequence_view<std::uint64_t const> values,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept;
+
+/**
+ * @brief reads a series of values encoded by base128 variant from the buffer.
+ * @details
+ *      This advances the `iterator` argument to the next of the last read value.
+ *      This stops reading values if the destination is filled, the buffer is exhausted,
+ *      or the next encoded value is wrong.
+ *      This is equivalent to calling read_unsigned() for each value, but is faster for a large number of values.
+ * @param iterator [INOUT] the buffer iterator
+ * @param end  the buffer limit
+ * @param destination the destination of the read values
+ * @return the number of read values
+ */
+size_type read_unsigned_values(
+        util::buffer_view::const_iterator& iterator,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::uint64_t> destination) noexcept;
+
+/// @copydoc write_unsigned_values()
+size_type write_signed_values(
+        util::sequence_view<std::int64_t const> values,
+        util::buffer_view::iterator& iterator,
+        util::buffer_view::const_iterator end) noexcept;
+
+/// @copydoc read_unsigned_values()
+size_type read_signed_values(
+        util::buffer_view::const_iterator& iterator,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::int64_t> destination) noexcept;
+
 } // namespace takatori::serializer::base128v
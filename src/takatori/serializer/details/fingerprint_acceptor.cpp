@@ -0,0 +1,95 @@
+#include "fingerprint_acceptor.h"
+
+#include <cstring>
+
+namespace takatori::serializer::details {
+
+namespace {
+
+enum class token : std::uint64_t {
+    string = 1,
+    integer,
+    unsigned_integer,
+    binary_float,
+    number,
+    boolean,
+    pointer,
+    struct_begin,
+    struct_end,
+    array_begin,
+    array_end,
+    property_begin,
+    property_end,
+};
+
+} // namespace
+
+static util::fingerprint_builder& add(util::fingerprint_builder& builder, token value) {
+    return builder.add(static_cast<std::uint64_t>(value));
+}
+
+void fingerprint_acceptor::string(std::string_view value) {
+    add(builder_, token::string).add(value);
+}
+
+void fingerprint_acceptor::integer(std::int64_t value) {
+    add(builder_, token::integer).add(static_cast<std::uint64_t>(value));
+}
+
+void fingerprint_acceptor::unsigned_integer(std::uint64_t value) {
+    add(builder_, token::unsigned_integer).add(value);
+}
+
+void fingerprint_acceptor::binary_float(double value) {
+    static_assert(sizeof(value) == sizeof(std::uint64_t));
+    std::uint64_t bits {};
+    std::memcpy(&bits, &value, sizeof(bits));
+    add(builder_, token::binary_float).add(bits);
+}
+
+void fingerprint_acceptor::number(decimal::triple value) {
+    add(builder_, token::number)
+        .add(static_cast<std::uint64_t>(value.sign()))
+        .add(value.coefficient_high())
+        .add(value.coefficient_low())
+        .add(static_cast<std::uint64_t>(value.exponent()));
+}
+
+void fingerprint_acceptor::boolean(bool value) {
+    add(builder_, token::boolean).add(static_cast<std::uint64_t>(value ? 1 : 0));
+}
+
+void fingerprint_acceptor::pointer(void const*) {
+    // the pointer value depends on the object location
+    add(builder_, token::pointer);
+}
+
+void fingerprint_acceptor::struct_begin() {
+    add(builder_, token::struct_begin);
+}
+
+void fingerprint_acceptor::struct_end() {
+    add(builder_, token::struct_end);
+}
+
+void fingerprint_acceptor::array_begin() {
+    add(builder_, token::array_begin);
+}
+
+void fingerprint_acceptor::array_end() {
+    add(builder_, token::array_end);
+}
+
+void fingerprint_acceptor::property_begin(std::string_view value) {
+    add(builder_, token::property_begin).add(value);
+}
+
+void fingerprint_acceptor::property_end() {
+    add(builder_, token::property_end);
+}
+
+util::fingerprint fingerprint_acceptor::build() const noexcept {
+    return builder_.build();
+}
+
+} // namespace takatori::serializer::details
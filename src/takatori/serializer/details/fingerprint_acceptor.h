@@ -0,0 +1,39 @@
+#pragma once
+
+#include <takatori/serializer/object_acceptor.h>
+
+#include <takatori/util/fingerprint.h>
+
+namespace takatori::serializer::details {
+
+/**
+ * @brief an object_acceptor which computes fingerprint of the accepted structure.
+ * @details This ignores the actual pointer values, because they are not a part of structure.
+ */
+class fingerprint_acceptor final : public object_acceptor {
+public:
+    void string(std::string_view value) override;
+    void integer(std::int64_t value) override;
+    void unsigned_integer(std::uint64_t value) override;
+    void binary_float(double value) override;
+    void number(decimal::triple value) override;
+    void boolean(bool value) override;
+    void pointer(void const* value) override;
+    void struct_begin() override;
+    void struct_end() override;
+    void array_begin() override;
+    void array_end() override;
+    void property_begin(std::string_view value) override;
+    void property_end() override;
+
+    /**
+     * @brief returns the fingerprint of the accepted structure.
+     * @return the fingerprint
+     */
+    [[nodiscard]] util::fingerprint build() const noexcept;
+
+private:
+    util::fingerprint_builder builder_ {};
+};
+
+} // namespace takatori::serializer::details
@@ -0,0 +1,254 @@
+#include "fingerprint_scanner.h"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <takatori/util/hash.h>
+
+#include "fingerprint_acceptor.h"
+
+namespace takatori::serializer::details {
+
+namespace {
+
+/// @brief a marker of unconnected input ports.
+constexpr std::uint64_t unconnected = 0;
+
+void accept_fingerprint(util::fingerprint value, object_acceptor& acceptor) {
+    acceptor.unsigned_integer(value.high());
+    acceptor.unsigned_integer(value.low());
+}
+
+/**
+ * @brief combines the individual vertex fingerprints into the graph fingerprint.
+ * @details The vertex fingerprints are sorted before combining them, to remove the dependency of vertex order.
+ */
+util::fingerprint combine_vertices(std::vector<util::fingerprint>& vertices) {
+    std::sort(vertices.begin(), vertices.end());
+    util::fingerprint_builder builder {};
+    builder.add(static_cast<std::uint64_t>(vertices.size()));
+    for (auto&& v : vertices) {
+        builder.add(v);
+    }
+    return builder.build();
+}
+
+} // namespace
+
+fingerprint_scanner::fingerprint_scanner(bool mask_literals) noexcept
+    : mask_literals_(mask_literals)
+{}
+
+void fingerprint_scanner::operator()(descriptor::variable const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::relation const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::function const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::aggregate_function const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::schema const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::storage const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(descriptor::declared_type const& element, object_acceptor& acceptor) const {
+    accept_descriptor(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(value::data const& element, object_acceptor& acceptor) const {
+    if (mask_literals_) {
+        // only keeps the value kind
+        acceptor.string(to_string_view(element.kind()));
+        return;
+    }
+    object_scanner::operator()(element, acceptor);
+}
+
+void fingerprint_scanner::operator()(relation::expression::graph_type const& element, object_acceptor& acceptor) const {
+    // nested graphs are computed in the current pass
+    accept_fingerprint(vertices_fingerprint(element), acceptor);
+}
+
+void fingerprint_scanner::operator()(plan::step::graph_type const& element, object_acceptor& acceptor) const {
+    accept_fingerprint(vertices_fingerprint(element), acceptor);
+}
+
+util::fingerprint fingerprint_scanner::fingerprint(relation::graph_type const& element) const {
+    return canonical_fingerprint(element);
+}
+
+util::fingerprint fingerprint_scanner::fingerprint(plan::graph_type const& element) const {
+    return canonical_fingerprint(element);
+}
+
+template<class Graph>
+util::fingerprint fingerprint_scanner::canonical_fingerprint(Graph const& element) const {
+    occurrences_.clear();
+    labels_.clear();
+    occurrence_index_ = 0;
+
+    pass_ = pass::sites;
+    (void) vertices_fingerprint(element);
+    build_labels();
+
+    pass_ = pass::labels;
+    auto result = vertices_fingerprint(element);
+
+    pass_ = pass::sites;
+    occurrences_.clear();
+    labels_.clear();
+    return result;
+}
+
+util::fingerprint fingerprint_scanner::vertices_fingerprint(relation::graph_type const& element) const {
+    // fingerprint of each vertex consists of its properties, and its upstream fingerprints in input port order
+    std::unordered_map<relation::expression const*, util::fingerprint> results {};
+    results.reserve(element.size());
+    std::vector<util::fingerprint> vertices {};
+    vertices.reserve(element.size());
+    relation::sort_from_upstream(element, [&](relation::expression const& vertex) {
+        auto frame = enter_site();
+        fingerprint_acceptor properties_acceptor {};
+        properties_acceptor.string(to_string_view(vertex.kind()));
+        properties(vertex, properties_acceptor);
+
+        util::fingerprint_builder builder {};
+        builder.add(properties_acceptor.build());
+        auto inputs = vertex.input_ports();
+        builder.add(static_cast<std::uint64_t>(inputs.size()));
+        for (auto&& port : inputs) {
+            auto opposite = port.opposite();
+            if (!opposite) {
+                builder.add(unconnected);
+                continue;
+            }
+            if (auto it = results.find(std::addressof(opposite->owner())); it != results.end()) {
+                builder.add(it->second);
+            } else {
+                // may be a cyclic graph
+                builder.add(unconnected);
+            }
+            builder.add(static_cast<std::uint64_t>(opposite->index()));
+        }
+        builder.add(static_cast<std::uint64_t>(vertex.output_ports().size()));
+
+        auto result = builder.build();
+        leave_site(frame, result);
+        results.emplace(std::addressof(vertex), result);
+        vertices.emplace_back(result);
+    });
+    return combine_vertices(vertices);
+}
+
+util::fingerprint fingerprint_scanner::vertices_fingerprint(plan::graph_type const& element) const {
+    // fingerprint of each step consists of its properties, and the multi-set of its upstream fingerprints
+    std::unordered_map<plan::step const*, util::fingerprint> results {};
+    results.reserve(element.size());
+    std::vector<util::fingerprint> vertices {};
+    vertices.reserve(element.size());
+    std::vector<util::fingerprint> upstreams {};
+    plan::sort_from_upstream(element, [&](plan::step const& vertex) {
+        auto frame = enter_site();
+        fingerprint_acceptor properties_acceptor {};
+        properties_acceptor.string(to_string_view(vertex.kind()));
+        properties(vertex, properties_acceptor);
+
+        upstreams.clear();
+        plan::enumerate_upstream(vertex, [&](plan::step const& upstream) {
+            if (auto it = results.find(std::addressof(upstream)); it != results.end()) {
+                upstreams.emplace_back(it->second);
+            } else {
+                // may be a cyclic graph
+                upstreams.emplace_back();
+            }
+        });
+        std::sort(upstreams.begin(), upstreams.end());
+
+        util::fingerprint_builder builder {};
+        builder.add(properties_acceptor.build());
+        builder.add(static_cast<std::uint64_t>(upstreams.size()));
+        for (auto&& upstream : upstreams) {
+            builder.add(upstream);
+        }
+
+        auto result = builder.build();
+        leave_site(frame, result);
+        results.emplace(std::addressof(vertex), result);
+        vertices.emplace_back(result);
+    });
+    return combine_vertices(vertices);
+}
+
+template<descriptor::descriptor_kind Kind>
+void fingerprint_scanner::accept_descriptor(descriptor::element<Kind> const& element, object_acceptor& acceptor) const {
+    void const* entity = element.optional_entity().get();
+    if (pass_ == pass::sites) {
+        // only records where the descriptor occurs, because its label is not yet available
+        occurrences_.emplace_back(
+                entity,
+                util::fingerprint_builder {}.add(occurrence_index_).build());
+        ++occurrence_index_;
+        acceptor.string(to_string_view(Kind));
+        return;
+    }
+    if (auto it = labels_.find(entity); it != labels_.end()) {
+        accept_fingerprint(it->second, acceptor);
+    } else {
+        // may be out of the target graph
+        accept_fingerprint({}, acceptor);
+    }
+}
+
+fingerprint_scanner::site_frame fingerprint_scanner::enter_site() const noexcept {
+    site_frame result { occurrences_.size(), occurrence_index_ };
+    occurrence_index_ = 0;
+    return result;
+}
+
+void fingerprint_scanner::leave_site(site_frame frame, util::fingerprint vertex) const {
+    occurrence_index_ = frame.index;
+    if (pass_ != pass::sites) {
+        return;
+    }
+    // qualifies the sites in the vertex (including the nested graphs) by the vertex fingerprint
+    for (auto i = frame.begin, n = occurrences_.size(); i < n; ++i) {
+        auto&& site = occurrences_[i].second;
+        site = util::fingerprint_builder {}.add(vertex).add(site).build();
+    }
+}
+
+void fingerprint_scanner::build_labels() const {
+    // groups the sites by descriptor, and the sites in each group are ordered canonically
+    std::sort(occurrences_.begin(), occurrences_.end(), [](auto const& a, auto const& b) {
+        if (a.first != b.first) {
+            return std::less<> {}(a.first, b.first);
+        }
+        return a.second < b.second;
+    });
+    for (auto it = occurrences_.begin(), end = occurrences_.end(); it != end;) {
+        auto* entity = it->first;
+        auto group_end = std::find_if(it, end, [&](auto const& e) { return e.first != entity; });
+        util::fingerprint_builder builder {};
+        builder.add(static_cast<std::uint64_t>(group_end - it));
+        for (; it != group_end; ++it) {
+            builder.add(it->second);
+        }
+        labels_.emplace(entity, builder.build());
+    }
+}
+
+} // namespace takatori::serializer::details
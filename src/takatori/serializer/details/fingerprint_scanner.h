@@ -0,0 +1,98 @@
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <takatori/relation/graph.h>
+#include <takatori/plan/graph.h>
+
+#include <takatori/serializer/object_acceptor.h>
+#include <takatori/serializer/object_scanner.h>
+
+#include <takatori/util/fingerprint.h>
+
+namespace takatori::serializer::details {
+
+/**
+ * @brief an object_scanner which computes canonical fingerprint of operator graphs.
+ * @details This replaces the some elements in the scanning structure:
+ *      @li descriptors - their canonical label (see below)
+ *      @li graphs - their canonical fingerprint, which does not depend on the order of vertices
+ *
+ *      The top-level fingerprint is computed in two passes. The first pass computes the fingerprint of each vertex
+ *      without descriptors, and records the sites where each descriptor occurs: the site is the fingerprint of
+ *      the enclosing vertices (including the enclosing step of the nested operator graphs), and the occurrence index
+ *      in the innermost one. The label of each descriptor is the fingerprint of the multi-set of its sites.
+ *      The second pass computes the vertex fingerprints again, by using the labels instead of the descriptors.
+ *
+ *      Neither the labels nor the vertex fingerprints depend on the order or the addresses of the vertices
+ *      and descriptors, so that the graphs built in the same way in any order, or from different descriptor objects,
+ *      have the same fingerprint.
+ */
+class fingerprint_scanner : public object_scanner {
+public:
+    /**
+     * @brief creates a new instance.
+     * @param mask_literals whether or not ignores the literal values in the scanning structure
+     */
+    explicit fingerprint_scanner(bool mask_literals) noexcept;
+
+    using object_scanner::operator();
+
+    void operator()(descriptor::variable const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::relation const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::function const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::aggregate_function const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::schema const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::storage const& element, object_acceptor& acceptor) const override;
+    void operator()(descriptor::declared_type const& element, object_acceptor& acceptor) const override;
+    void operator()(value::data const& element, object_acceptor& acceptor) const override;
+    void operator()(relation::expression::graph_type const& element, object_acceptor& acceptor) const override;
+    void operator()(plan::step::graph_type const& element, object_acceptor& acceptor) const override;
+
+    /**
+     * @brief computes the canonical fingerprint of the given graph.
+     * @param element the target graph
+     * @return the fingerprint
+     */
+    [[nodiscard]] util::fingerprint fingerprint(relation::graph_type const& element) const;
+
+    /// @copydoc fingerprint(relation::graph_type const&) const
+    [[nodiscard]] util::fingerprint fingerprint(plan::graph_type const& element) const;
+
+private:
+    enum class pass {
+        sites,
+        labels,
+    };
+
+    struct site_frame {
+        std::size_t begin;
+        std::uint64_t index;
+    };
+
+    bool mask_literals_;
+    mutable pass pass_ { pass::sites };
+    mutable std::uint64_t occurrence_index_ {};
+    mutable std::vector<std::pair<void const*, util::fingerprint>> occurrences_ {};
+    mutable std::unordered_map<void const*, util::fingerprint> labels_ {};
+
+    template<class Graph>
+    [[nodiscard]] util::fingerprint canonical_fingerprint(Graph const& element) const;
+
+    [[nodiscard]] util::fingerprint vertices_fingerprint(relation::graph_type const& element) const;
+    [[nodiscard]] util::fingerprint vertices_fingerprint(plan::graph_type const& element) const;
+
+    template<descriptor::descriptor_kind Kind>
+    void accept_descriptor(descriptor::element<Kind> const& element, object_acceptor& acceptor) const;
+
+    [[nodiscard]] site_frame enter_site() const noexcept;
+    void leave_site(site_frame frame, util::fingerprint vertex) const;
+    void build_labels() const;
+};
+
+} // namespace takatori::serializer::details
@@ -1,5 +1,7 @@
 #include "relation_expression_property_scanner.h"
 
+#include "scalar_expression_property_scanner.h"
+
 namespace takatori::serializer::details {
 
 using namespace std::string_view_literals;
@@ -171,7 +173,14 @@ void relation_expression_property_scanner::operator()(relation::values const& el
     acceptor_.property_end();
 
     acceptor_.property_begin("rows"sv);
-    accept_foreach(element.rows());
+    acceptor_.array_begin();
+    for (auto&& row : element.rows()) {
+        accept(row);
+    }
+    if (auto block = element.block()) {
+        accept_rows(*block);
+    }
+    acceptor_.array_end();
     acceptor_.property_end();
 }
 
@@ -488,6 +497,24 @@ void relation_expression_property_scanner::accept(relation::details::values_row
     acceptor_.struct_end();
 }
 
+void relation_expression_property_scanner::accept_rows(scalar::literal_block const& element) {
+    // emits the same structure as values_row, without materializing the individual cells
+    auto&& columns = element.columns();
+    for (std::size_t r = 0, n = element.row_count(); r < n; ++r) {
+        acceptor_.struct_begin();
+
+        acceptor_.property_begin("elements"sv);
+        acceptor_.array_begin();
+        for (std::size_t c = 0, m = columns.size(); c < m; ++c) {
+            scalar_expression_property_scanner::accept_cell(scanner_, acceptor_, columns[c], r);
+        }
+        acceptor_.array_end();
+        acceptor_.property_end();
+
+        acceptor_.struct_end();
+    }
+}
+
 void relation_expression_property_scanner::accept(relation::details::aggregate_element const& element) {
     acceptor_.struct_begin();
 
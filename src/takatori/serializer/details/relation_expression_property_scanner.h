@@ -107,6 +107,8 @@ private:
 
     void accept(relation::details::values_row const& element);
 
+    void accept_rows(scalar::literal_block const& element);
+
     void accept(relation::details::aggregate_element const& element);
 
     void accept(relation::details::union_element const& element);
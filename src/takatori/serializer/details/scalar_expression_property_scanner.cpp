@@ -21,6 +21,31 @@ void scalar_expression_property_scanner::operator()(scalar::immediate const& ele
     acceptor_.property_end();
 }
 
+void scalar_expression_property_scanner::accept_cell(
+        object_scanner const& scanner,
+        object_acceptor& acceptor,
+        scalar::literal_block::column const& column,
+        std::size_t row) {
+    // emits the same structure as object_scanner does for scalar::immediate
+    acceptor.struct_begin();
+
+    acceptor.property_begin("kind"sv);
+    acceptor.string(to_string_view(scalar::expression_kind::immediate));
+    acceptor.property_end();
+
+    acceptor.property_begin("value"sv);
+    column.visit(row, [&](value::data const& value) { scanner(value, acceptor); });
+    acceptor.property_end();
+
+    acceptor.property_begin("type"sv);
+    if (auto&& type = column.shared_type()) {
+        scanner(*type, acceptor);
+    }
+    acceptor.property_end();
+
+    acceptor.struct_end();
+}
+
 void scalar_expression_property_scanner::operator()(scalar::variable_reference const& element) {
     acceptor_.property_begin("variable"sv);
     accept(element.variable());
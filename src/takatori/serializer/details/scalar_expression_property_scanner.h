@@ -12,6 +12,7 @@
 #include <takatori/scalar/let.h>
 #include <takatori/scalar/function_call.h>
 #include <takatori/scalar/extension.h>
+#include <takatori/scalar/literal_block.h>
 
 #include <takatori/serializer/object_acceptor.h>
 #include <takatori/serializer/object_scanner.h>
@@ -35,6 +36,19 @@ public:
     void operator()(scalar::function_call const& element);
     void operator()(scalar::extension const& element);
 
+    /**
+     * @brief emits the given cell of literal_block as scalar::immediate, without materializing it.
+     * @param scanner the object scanner
+     * @param acceptor the destination acceptor
+     * @param column the source column
+     * @param row the row index in the column
+     */
+    static void accept_cell(
+            object_scanner const& scanner,
+            object_acceptor& acceptor,
+            scalar::literal_block::column const& column,
+            std::size_t row);
+
 private:
     object_scanner const& scanner_;
     object_acceptor& acceptor_;
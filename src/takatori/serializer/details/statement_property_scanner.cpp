@@ -1,5 +1,7 @@
 #include "statement_property_scanner.h"
 
+#include "scalar_expression_property_scanner.h"
+
 namespace takatori::serializer::details {
 
 using namespace std::string_view_literals;
@@ -31,7 +33,14 @@ void statement_property_scanner::operator()(statement::write const& element) {
     acceptor_.property_end();
 
     acceptor_.property_begin("tuples"sv);
-    accept_foreach(element.tuples());
+    acceptor_.array_begin();
+    for (auto&& tuple : element.tuples()) {
+        accept(tuple);
+    }
+    if (auto block = element.block()) {
+        accept_tuples(*block);
+    }
+    acceptor_.array_end();
     acceptor_.property_end();
 }
 
@@ -197,6 +206,18 @@ void statement_property_scanner::accept(statement::details::write_tuple const& e
     accept_foreach(element.elements());
 }
 
+void statement_property_scanner::accept_tuples(scalar::literal_block const& element) {
+    // emits the same structure as write_tuple, without materializing the individual cells
+    auto&& columns = element.columns();
+    for (std::size_t r = 0, n = element.row_count(); r < n; ++r) {
+        acceptor_.array_begin();
+        for (std::size_t c = 0, m = columns.size(); c < m; ++c) {
+            scalar_expression_property_scanner::accept_cell(scanner_, acceptor_, columns[c], r);
+        }
+        acceptor_.array_end();
+    }
+}
+
 void statement_property_scanner::accept(statement::details::table_privilege_element const& element) {
     acceptor_.struct_begin();
 
@@ -57,6 +57,8 @@ private:
 
     void accept(statement::details::write_tuple const& element);
 
+    void accept_tuples(scalar::literal_block const& element);
+
     void accept(statement::details::table_privilege_element const& element);
 
     void accept(statement::details::table_authorization_entry const& element);
@@ -0,0 +1,605 @@
+#include <takatori/serializer/key_encoding.h>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <takatori/serializer/value_input_exception.h>
+
+#include <takatori/value/primitive.h>
+#include <takatori/value/decimal.h>
+#include <takatori/value/character.h>
+#include <takatori/value/octet.h>
+#include <takatori/value/date.h>
+#include <takatori/value/time_of_day.h>
+#include <takatori/value/time_point.h>
+#include <takatori/value/unknown.h>
+
+#include <takatori/util/downcast.h>
+#include <takatori/util/exception.h>
+#include <takatori/util/string_builder.h>
+
+namespace takatori::serializer {
+
+using util::buffer_view;
+using util::string_builder;
+using util::throw_exception;
+
+using relation::sort_direction;
+
+namespace {
+
+// NOTE: GCC and Clang extension, only used in this translation unit
+__extension__ using uint128 = unsigned __int128;
+
+constexpr unsigned char marker_null_first = 0x00U;
+constexpr unsigned char marker_value = 0x01U;
+constexpr unsigned char marker_null_last = 0x02U;
+
+constexpr unsigned char decimal_negative = 0x00U;
+constexpr unsigned char decimal_zero = 0x01U;
+constexpr unsigned char decimal_positive = 0x02U;
+
+constexpr unsigned char string_escape = 0x00U;
+constexpr unsigned char string_escaped_zero = 0xffU;
+constexpr unsigned char string_terminator = 0x00U;
+
+// the max number of decimal digits in 128-bit unsigned integers
+constexpr std::size_t max_decimal_digits = 39;
+
+constexpr unsigned char null_marker(null_order nulls) noexcept {
+    return nulls == null_order::first ? marker_null_first : marker_null_last;
+}
+
+// complements the octets from the given offset
+void complement(std::string& output, std::size_t offset) noexcept {
+    for (auto i = offset, n = output.size(); i < n; ++i) {
+        output[i] = static_cast<char>(~static_cast<unsigned char>(output[i]));
+    }
+}
+
+// writes the field marker, and then writes the body which is complemented if the direction is descendant
+template<class Body>
+void write_field(std::string& output, sort_direction direction, Body&& body) {
+    output.push_back(static_cast<char>(marker_value));
+    auto offset = output.size();
+    body(output);
+    if (direction == sort_direction::descendant) {
+        complement(output, offset);
+    }
+}
+
+template<class T>
+void append_fixed(std::string& output, T value) {
+    static_assert(std::is_unsigned_v<T>);
+    for (std::size_t i = 1; i <= sizeof(T); ++i) {
+        output.push_back(static_cast<char>(static_cast<unsigned char>(value >> ((sizeof(T) - i) * 8U))));
+    }
+}
+
+constexpr std::uint32_t flip_sign(std::int32_t value) noexcept {
+    return static_cast<std::uint32_t>(value) ^ (std::uint32_t { 1 } << 31U);
+}
+
+constexpr std::uint64_t flip_sign(std::int64_t value) noexcept {
+    return static_cast<std::uint64_t>(value) ^ (std::uint64_t { 1 } << 63U);
+}
+
+template<class Unsigned, class Float>
+Unsigned ordered_float_bits(Float value) noexcept {
+    static_assert(sizeof(Unsigned) == sizeof(Float));
+    if (std::isnan(value)) {
+        value = std::numeric_limits<Float>::quiet_NaN();
+    } else if (value == 0) {
+        value = 0;
+    }
+    Unsigned bits {};
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr auto sign_bit = static_cast<Unsigned>(Unsigned { 1 } << (sizeof(Unsigned) * 8U - 1U));
+    if ((bits & sign_bit) != 0) {
+        return static_cast<Unsigned>(~bits);
+    }
+    return static_cast<Unsigned>(bits | sign_bit);
+}
+
+template<class Float, class Unsigned>
+Float restore_float_bits(Unsigned bits) noexcept {
+    static_assert(sizeof(Unsigned) == sizeof(Float));
+    constexpr auto sign_bit = static_cast<Unsigned>(Unsigned { 1 } << (sizeof(Unsigned) * 8U - 1U));
+    if ((bits & sign_bit) != 0) {
+        bits = static_cast<Unsigned>(bits & ~sign_bit);
+    } else {
+        bits = static_cast<Unsigned>(~bits);
+    }
+    Float result {};
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void append_string(std::string& output, std::string_view value) {
+    output.reserve(output.size() + value.size() + 2);
+    for (auto c : value) {
+        output.push_back(c);
+        if (static_cast<unsigned char>(c) == string_escape) {
+            output.push_back(static_cast<char>(string_escaped_zero));
+        }
+    }
+    output.push_back(static_cast<char>(string_escape));
+    output.push_back(static_cast<char>(string_terminator));
+}
+
+void append_decimal(std::string& output, decimal::triple value) {
+    if (value.sign() == 0) {
+        output.push_back(static_cast<char>(decimal_zero));
+        return;
+    }
+    auto coefficient = (static_cast<uint128>(value.coefficient_high()) << 64U) | value.coefficient_low();
+    auto exponent = static_cast<std::int64_t>(value.exponent());
+    while (coefficient % 10U == 0) {
+        coefficient /= 10U;
+        ++exponent;
+    }
+    std::array<unsigned char, max_decimal_digits> digits {};
+    std::size_t ndigits = 0;
+    for (; coefficient != 0; coefficient /= 10U) {
+        digits[max_decimal_digits - ++ndigits] = static_cast<unsigned char>(coefficient % 10U); // NOLINT
+    }
+    auto adjusted = exponent + static_cast<std::int64_t>(ndigits) - 1;
+
+    output.push_back(static_cast<char>(value.sign() > 0 ? decimal_positive : decimal_negative));
+    auto offset = output.size();
+    append_fixed(output, flip_sign(adjusted));
+
+    // packs digits into nibbles (1-10), and then terminates with nibble 0
+    auto const* first = digits.data() + (max_decimal_digits - ndigits); // NOLINT
+    for (std::size_t i = 0; i < ndigits; i += 2) {
+        auto high = static_cast<unsigned>(first[i] + 1U); // NOLINT
+        auto low = i + 1 < ndigits ? static_cast<unsigned>(first[i + 1] + 1U) : 0U; // NOLINT
+        output.push_back(static_cast<char>((high << 4U) | low));
+    }
+    if (ndigits % 2 == 0) {
+        output.push_back('\0');
+    }
+    if (value.sign() < 0) {
+        complement(output, offset);
+    }
+}
+
+[[noreturn]] void throw_malformed_key(char const* message) {
+    throw_exception(value_input_exception {
+            value_input_exception::reason_code::value_out_of_range,
+            string_builder {}
+                    << "malformed key: " << message
+                    << string_builder::to_string,
+    });
+}
+
+// reads the key field body octets, which may be complemented
+class field_reader {
+public:
+    field_reader(
+            buffer_view::const_iterator position,
+            buffer_view::const_iterator end,
+            sort_direction direction) noexcept :
+        position_ { position },
+        end_ { end },
+        mask_ { static_cast<unsigned char>(direction == sort_direction::descendant ? 0xffU : 0x00U) }
+    {}
+
+    [[nodiscard]] unsigned char next() {
+        if (position_ >= end_) {
+            throw_buffer_underflow();
+        }
+        auto result = static_cast<unsigned char>(static_cast<unsigned char>(*position_) ^ mask_);
+        ++position_;
+        return result;
+    }
+
+    template<class T>
+    [[nodiscard]] T next_fixed() {
+        static_assert(std::is_unsigned_v<T>);
+        T result {};
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            result = static_cast<T>(result << 8U) | next();
+        }
+        return result;
+    }
+
+    [[nodiscard]] buffer_view::const_iterator position() const noexcept {
+        return position_;
+    }
+
+private:
+    buffer_view::const_iterator position_;
+    buffer_view::const_iterator end_;
+    unsigned char mask_;
+};
+
+// reads the field marker, and then reads its body only if it is not null
+template<class T, class Body>
+std::optional<T> read_field(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls,
+        Body&& body) {
+    if (position >= end) {
+        throw_buffer_underflow();
+    }
+    auto marker = static_cast<unsigned char>(*position);
+    if (marker == null_marker(nulls)) {
+        ++position;
+        return std::nullopt;
+    }
+    if (marker != marker_value) {
+        throw_unrecognized_entry(marker);
+    }
+    field_reader reader { position + 1, end, direction };
+    T result = body(reader);
+    position = reader.position();
+    return result;
+}
+
+std::string read_string(field_reader& reader) {
+    std::string result {};
+    while (true) {
+        auto c = reader.next();
+        if (c == string_escape) {
+            auto next = reader.next();
+            if (next == string_terminator) {
+                break;
+            }
+            if (next != string_escaped_zero) {
+                throw_malformed_key("invalid escape sequence in string");
+            }
+        }
+        result.push_back(static_cast<char>(c));
+    }
+    return result;
+}
+
+decimal::triple read_decimal(field_reader& reader) {
+    auto sign = reader.next();
+    if (sign == decimal_zero) {
+        return {};
+    }
+    if (sign != decimal_positive && sign != decimal_negative) {
+        throw_malformed_key("invalid decimal sign");
+    }
+    unsigned char mask = sign == decimal_negative ? 0xffU : 0x00U;
+    auto next = [&]() -> unsigned char {
+        return static_cast<unsigned char>(reader.next() ^ mask);
+    };
+    std::uint64_t adjusted_bits = 0;
+    for (std::size_t i = 0; i < sizeof(adjusted_bits); ++i) {
+        adjusted_bits = (adjusted_bits << 8U) | next();
+    }
+    auto adjusted = static_cast<std::int64_t>(adjusted_bits ^ (std::uint64_t { 1 } << 63U));
+
+    uint128 coefficient = 0;
+    std::size_t ndigits = 0;
+    auto push_digit = [&](unsigned nibble) {
+        if (nibble > 10U || ndigits >= max_decimal_digits) {
+            throw_malformed_key("invalid decimal digits");
+        }
+        auto digit = nibble - 1U;
+        constexpr auto limit = ~uint128 { 0 };
+        if (coefficient > (limit - digit) / 10U) {
+            throw_malformed_key("decimal coefficient is too large");
+        }
+        coefficient = coefficient * 10U + digit;
+        ++ndigits;
+    };
+    while (true) {
+        auto octet = next();
+        auto high = static_cast<unsigned>(octet >> 4U);
+        auto low = static_cast<unsigned>(octet & 0x0fU);
+        if (high == 0) {
+            if (low != 0) {
+                throw_malformed_key("invalid decimal digits");
+            }
+            break;
+        }
+        push_digit(high);
+        if (low == 0) {
+            break;
+        }
+        push_digit(low);
+    }
+    if (ndigits == 0) {
+        throw_malformed_key("decimal without digits");
+    }
+    auto exponent = adjusted - static_cast<std::int64_t>(ndigits - 1);
+    if (exponent < std::numeric_limits<std::int32_t>::min() || exponent > std::numeric_limits<std::int32_t>::max()) {
+        throw_int32_value_out_of_range(exponent);
+    }
+    return decimal::triple {
+            sign == decimal_positive ? +1 : -1,
+            static_cast<std::uint64_t>(coefficient >> 64U),
+            static_cast<std::uint64_t>(coefficient),
+            static_cast<std::int32_t>(exponent),
+    };
+}
+
+} // namespace
+
+void write_key_null(std::string& output, null_order nulls) {
+    output.push_back(static_cast<char>(null_marker(nulls)));
+}
+
+void write_key_boolean(bool value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        out.push_back(static_cast<char>(value ? 1 : 0));
+    });
+}
+
+void write_key_int4(std::int32_t value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, flip_sign(value));
+    });
+}
+
+void write_key_int8(std::int64_t value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, flip_sign(value));
+    });
+}
+
+void write_key_float4(float value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, ordered_float_bits<std::uint32_t>(value));
+    });
+}
+
+void write_key_float8(double value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, ordered_float_bits<std::uint64_t>(value));
+    });
+}
+
+void write_key_decimal(decimal::triple value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_decimal(out, value);
+    });
+}
+
+void write_key_character(std::string_view value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_string(out, value);
+    });
+}
+
+void write_key_octet(std::string_view value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_string(out, value);
+    });
+}
+
+void write_key_date(datetime::date value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, flip_sign(static_cast<std::int64_t>(value.days_since_epoch())));
+    });
+}
+
+void write_key_time_of_day(datetime::time_of_day value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, static_cast<std::uint64_t>(value.time_since_epoch().count()));
+    });
+}
+
+void write_key_time_point(datetime::time_point value, std::string& output, sort_direction direction, null_order) {
+    write_field(output, direction, [&](std::string& out) {
+        append_fixed(out, flip_sign(static_cast<std::int64_t>(value.seconds_since_epoch().count())));
+        append_fixed(out, static_cast<std::uint32_t>(value.subsecond().count()));
+    });
+}
+
+void write_key(value::data const& value, std::string& output, sort_direction direction, null_order nulls) {
+    using kind = value::value_kind;
+    switch (value.kind()) {
+        case kind::unknown:
+            write_key_null(output, nulls);
+            return;
+        case kind::boolean:
+            write_key_boolean(util::unsafe_downcast<value::boolean>(value).get(), output, direction, nulls);
+            return;
+        case kind::int4:
+            write_key_int4(util::unsafe_downcast<value::int4>(value).get(), output, direction, nulls);
+            return;
+        case kind::int8:
+            write_key_int8(util::unsafe_downcast<value::int8>(value).get(), output, direction, nulls);
+            return;
+        case kind::float4:
+            write_key_float4(util::unsafe_downcast<value::float4>(value).get(), output, direction, nulls);
+            return;
+        case kind::float8:
+            write_key_float8(util::unsafe_downcast<value::float8>(value).get(), output, direction, nulls);
+            return;
+        case kind::decimal:
+            write_key_decimal(util::unsafe_downcast<value::decimal>(value).get(), output, direction, nulls);
+            return;
+        case kind::character:
+            write_key_character(util::unsafe_downcast<value::character>(value).get(), output, direction, nulls);
+            return;
+        case kind::octet:
+            write_key_octet(util::unsafe_downcast<value::octet>(value).get(), output, direction, nulls);
+            return;
+        case kind::date:
+            write_key_date(util::unsafe_downcast<value::date>(value).get(), output, direction, nulls);
+            return;
+        case kind::time_of_day:
+            write_key_time_of_day(util::unsafe_downcast<value::time_of_day>(value).get(), output, direction, nulls);
+            return;
+        case kind::time_point:
+            write_key_time_point(util::unsafe_downcast<value::time_point>(value).get(), output, direction, nulls);
+            return;
+        default:
+            break;
+    }
+    throw_exception(std::invalid_argument(string_builder {}
+            << "unsupported key kind: " << value.kind()
+            << string_builder::to_string));
+}
+
+std::optional<bool> read_key_boolean(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<bool>(position, end, direction, nulls, [](field_reader& reader) {
+        auto value = reader.next();
+        if (value > 1U) {
+            throw_malformed_key("invalid boolean");
+        }
+        return value != 0;
+    });
+}
+
+std::optional<std::int32_t> read_key_int4(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<std::int32_t>(position, end, direction, nulls, [](field_reader& reader) {
+        return static_cast<std::int32_t>(reader.next_fixed<std::uint32_t>() ^ (std::uint32_t { 1 } << 31U));
+    });
+}
+
+std::optional<std::int64_t> read_key_int8(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<std::int64_t>(position, end, direction, nulls, [](field_reader& reader) {
+        return static_cast<std::int64_t>(reader.next_fixed<std::uint64_t>() ^ (std::uint64_t { 1 } << 63U));
+    });
+}
+
+std::optional<float> read_key_float4(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<float>(position, end, direction, nulls, [](field_reader& reader) {
+        return restore_float_bits<float>(reader.next_fixed<std::uint32_t>());
+    });
+}
+
+std::optional<double> read_key_float8(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<double>(position, end, direction, nulls, [](field_reader& reader) {
+        return restore_float_bits<double>(reader.next_fixed<std::uint64_t>());
+    });
+}
+
+std::optional<decimal::triple> read_key_decimal(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<decimal::triple>(position, end, direction, nulls, [](field_reader& reader) {
+        return read_decimal(reader);
+    });
+}
+
+std::optional<std::string> read_key_character(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<std::string>(position, end, direction, nulls, [](field_reader& reader) {
+        return read_string(reader);
+    });
+}
+
+std::optional<std::string> read_key_octet(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<std::string>(position, end, direction, nulls, [](field_reader& reader) {
+        return read_string(reader);
+    });
+}
+
+std::optional<datetime::date> read_key_date(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<datetime::date>(position, end, direction, nulls, [](field_reader& reader) {
+        auto days = static_cast<std::int64_t>(reader.next_fixed<std::uint64_t>() ^ (std::uint64_t { 1 } << 63U));
+        return datetime::date { days };
+    });
+}
+
+std::optional<datetime::time_of_day> read_key_time_of_day(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<datetime::time_of_day>(position, end, direction, nulls, [](field_reader& reader) {
+        return datetime::time_of_day { datetime::time_of_day::time_unit { reader.next_fixed<std::uint64_t>() } };
+    });
+}
+
+std::optional<datetime::time_point> read_key_time_point(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    return read_field<datetime::time_point>(position, end, direction, nulls, [](field_reader& reader) {
+        auto seconds = static_cast<std::int64_t>(reader.next_fixed<std::uint64_t>() ^ (std::uint64_t { 1 } << 63U));
+        auto nanos = reader.next_fixed<std::uint32_t>();
+        return datetime::time_point {
+                datetime::time_point::offset_type { seconds },
+                std::chrono::nanoseconds { nanos },
+        };
+    });
+}
+
+namespace {
+
+template<class Value, class T>
+std::unique_ptr<value::data> to_value(std::optional<T> value) {
+    if (!value) {
+        return std::make_unique<value::unknown>();
+    }
+    return std::make_unique<Value>(std::move(*value));
+}
+
+} // namespace
+
+std::unique_ptr<value::data> read_key(
+        value::value_kind kind,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        sort_direction direction,
+        null_order nulls) {
+    using k = value::value_kind;
+    switch (kind) {
+        case k::boolean: return to_value<value::boolean>(read_key_boolean(position, end, direction, nulls));
+        case k::int4: return to_value<value::int4>(read_key_int4(position, end, direction, nulls));
+        case k::int8: return to_value<value::int8>(read_key_int8(position, end, direction, nulls));
+        case k::float4: return to_value<value::float4>(read_key_float4(position, end, direction, nulls));
+        case k::float8: return to_value<value::float8>(read_key_float8(position, end, direction, nulls));
+        case k::decimal: return to_value<value::decimal>(read_key_decimal(position, end, direction, nulls));
+        case k::character: return to_value<value::character>(read_key_character(position, end, direction, nulls));
+        case k::octet: return to_value<value::octet>(read_key_octet(position, end, direction, nulls));
+        case k::date: return to_value<value::date>(read_key_date(position, end, direction, nulls));
+        case k::time_of_day: return to_value<value::time_of_day>(read_key_time_of_day(position, end, direction, nulls));
+        case k::time_point: return to_value<value::time_point>(read_key_time_point(position, end, direction, nulls));
+        default:
+            break;
+    }
+    throw_exception(std::invalid_argument(string_builder {}
+            << "unsupported key kind: " << kind
+            << string_builder::to_string));
+}
+
+} // namespace takatori::serializer
@@ -8,6 +8,7 @@
 #include "details/value_io_constants.h"
 
 #include <takatori/util/assertion.h>
+#include <takatori/util/either.h>
 #include <takatori/util/exception.h>
 #include <takatori/util/fail.h>
 #include <takatori/util/string_builder.h>
@@ -22,105 +23,97 @@ using util::const_bitset_view;
 
 using byte_type = buffer_view::value_type;
 
-static void requires_entry(
-        entry_type expect,
-        buffer_view::const_iterator position,
-        buffer_view::const_iterator end) {
-    if (auto ret = peek_type(position, end); ret != expect) {
-        using ::takatori::util::string_builder;
-        using ::takatori::util::throw_exception;
-        throw_exception(std::runtime_error(string_builder {}
-                << "inconsistent entry type: "
-                << "retrieved '" << ret << "', "
-                << "but expected is '" << expect << "'"
-                << string_builder::to_string));
-    }
-}
+namespace {
 
-template<class T>
-static std::optional<T> extract(
-        buffer_view::value_type first,
-        std::uint32_t header,
-        std::uint32_t mask,
-        T min_value) {
-    auto unsigned_value = static_cast<unsigned char>(first);
-    if (header <= unsigned_value && unsigned_value <= header + mask) {
-        return { static_cast<T>(unsigned_value - header) + min_value };
-    }
-    return std::nullopt;
-}
+/*
+ * The individual decoders never throw exceptions, and they advance the buffer iterator only if they are
+ * successfully completed.
+ * Instead, they return the failure, which read_*() raises as an exception, and try_read_*() returns as is.
+ */
 
-static std::int64_t read_sint(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    if (auto result = base128v::read_signed(position, end)) {
-        return *result;
-    }
-    throw_buffer_underflow();
-}
+// represents a reason of decoding failure, with information to build the corresponding exception
+struct failure {
+    enum class kind_type {
+        buffer_underflow,
+        unrecognized_entry,
+        inconsistent_entry,
+        int32_out_of_range,
+        decimal_coefficient_out_of_range,
+        size_out_of_range,
+    };
 
-static std::uint64_t read_uint(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    if (auto result = base128v::read_unsigned(position, end)) {
-        return *result;
-    }
-    throw_buffer_underflow();
-}
+    kind_type kind;
+    std::uint64_t value {};
+    entry_type expected {};
+    entry_type retrieved {};
+};
 
-static std::int32_t read_sint32(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    auto value = read_sint(position, end);
-    if (value < std::numeric_limits<std::int32_t>::min() || value > std::numeric_limits<std::int32_t>::max()) {
-        throw_int32_value_out_of_range(value);
-    }
-    return static_cast<std::int32_t>(value);
+template<class T>
+using outcome = util::either<failure, T>;
+
+constexpr failure underflow() noexcept {
+    return failure { failure::kind_type::buffer_underflow };
 }
 
-static std::uint32_t read_size(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    auto size = read_uint(position, end);
-    if (size >= limit_size) {
-        throw_size_out_of_range(size, limit_size);
+[[noreturn]] void raise(failure const& reason) {
+    using kind = failure::kind_type;
+    switch (reason.kind) {
+        case kind::buffer_underflow:
+            throw_buffer_underflow();
+        case kind::unrecognized_entry:
+            throw_unrecognized_entry(static_cast<std::uint32_t>(reason.value));
+        case kind::inconsistent_entry: {
+            using ::takatori::util::string_builder;
+            using ::takatori::util::throw_exception;
+            throw_exception(std::runtime_error(string_builder {}
+                    << "inconsistent entry type: "
+                    << "retrieved '" << reason.retrieved << "', "
+                    << "but expected is '" << reason.expected << "'"
+                    << string_builder::to_string));
+        }
+        case kind::int32_out_of_range:
+            throw_int32_value_out_of_range(static_cast<std::int64_t>(reason.value));
+        case kind::decimal_coefficient_out_of_range:
+            throw_decimal_coefficient_out_of_range(static_cast<std::size_t>(reason.value));
+        case kind::size_out_of_range:
+            throw_size_out_of_range(reason.value, limit_size);
     }
-    return static_cast<std::uint32_t>(size);
+    std::abort();
 }
 
-static const_buffer_view read_bytes(
-        std::size_t size,
-        buffer_view::const_iterator& position,
-        buffer_view::const_iterator end) {
-    if (std::distance(position, end) < static_cast<buffer_view::difference_type>(size)) {
-        throw_buffer_underflow();
+constexpr value_input_exception::reason_code to_reason_code(failure const& reason) noexcept {
+    using kind = failure::kind_type;
+    using code = value_input_exception::reason_code;
+    switch (reason.kind) {
+        case kind::buffer_underflow: return code::buffer_underflow;
+        case kind::unrecognized_entry: return code::unrecognized_entry_type;
+        case kind::inconsistent_entry: return code::inconsistent_entry_type;
+        case kind::int32_out_of_range: return code::value_out_of_range;
+        case kind::decimal_coefficient_out_of_range: return code::value_out_of_range;
+        case kind::size_out_of_range: return code::value_out_of_range;
     }
-    const_buffer_view result { position, size };
-    position += size;
-    return result;
+    std::abort();
 }
 
 template<class T>
-static T read_fixed(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    static_assert(std::is_integral_v<T>);
-    static_assert(std::is_unsigned_v<T>);
-    if (std::distance(position, end) < static_cast<buffer_view::difference_type>(sizeof(T))) {
-        throw_buffer_underflow();
+T unwrap(outcome<T>&& result) {
+    if (result) {
+        return std::move(*result);
     }
-    T result { 0 };
-    for (std::size_t i = 1; i <= sizeof(T); ++i) {
-        T value { static_cast<unsigned char>(*position) };
-        result |= value << ((sizeof(T) - i) * 8U);
-        ++position;
-    }
-    return result;
-}
-
-void read_end_of_contents(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::end_of_contents, position, end);
-    ++position;
+    raise(result.error());
 }
 
-void read_null(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::null, position, end);
-    ++position;
+template<class T>
+value_input_result<T> to_result(outcome<T>&& result) noexcept {
+    if (result) {
+        return std::move(*result);
+    }
+    return to_reason_code(result.error());
 }
 
-entry_type peek_type(buffer_view::const_iterator position, buffer_view::const_iterator end) {
+outcome<entry_type> decode_type(buffer_view::const_iterator position, buffer_view::const_iterator end) noexcept {
     if (position == end) {
-        throw_buffer_underflow();
+        return underflow();
     }
     std::uint32_t head = static_cast<unsigned char>(*position);
     if (head <= header_embed_positive_int + mask_embed_positive_int) {
@@ -171,12 +164,120 @@ entry_type peek_type(buffer_view::const_iterator position, buffer_view::const_it
         case header_unknown: return entry_type::null;
 
         default:
-            throw_unrecognized_entry(static_cast<unsigned char>(head));
+            return failure { failure::kind_type::unrecognized_entry, head };
     }
 }
 
-std::int64_t read_int(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::int_, position, end);
+std::optional<failure> check_entry(
+        entry_type expect,
+        buffer_view::const_iterator position,
+        buffer_view::const_iterator end) noexcept {
+    auto ret = decode_type(position, end);
+    if (!ret) {
+        return ret.error();
+    }
+    if (*ret != expect) {
+        return failure { failure::kind_type::inconsistent_entry, 0, expect, *ret };
+    }
+    return std::nullopt;
+}
+
+template<class T>
+std::optional<T> extract(
+        buffer_view::value_type first,
+        std::uint32_t header,
+        std::uint32_t mask,
+        T min_value) noexcept {
+    auto unsigned_value = static_cast<unsigned char>(first);
+    if (header <= unsigned_value && unsigned_value <= header + mask) {
+        return { static_cast<T>(unsigned_value - header) + min_value };
+    }
+    return std::nullopt;
+}
+
+outcome<std::int64_t> decode_sint(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    if (auto result = base128v::read_signed(position, end)) {
+        return *result;
+    }
+    return underflow();
+}
+
+outcome<std::uint64_t> decode_uint(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    if (auto result = base128v::read_unsigned(position, end)) {
+        return *result;
+    }
+    return underflow();
+}
+
+outcome<std::int32_t> decode_sint32(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    auto iter = position;
+    auto value = decode_sint(iter, end);
+    if (!value) {
+        return value.error();
+    }
+    if (*value < std::numeric_limits<std::int32_t>::min() || *value > std::numeric_limits<std::int32_t>::max()) {
+        return failure { failure::kind_type::int32_out_of_range, static_cast<std::uint64_t>(*value) };
+    }
+    position = iter;
+    return static_cast<std::int32_t>(*value);
+}
+
+outcome<std::uint32_t> decode_size(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    auto iter = position;
+    auto size = decode_uint(iter, end);
+    if (!size) {
+        return size.error();
+    }
+    if (*size >= limit_size) {
+        return failure { failure::kind_type::size_out_of_range, *size };
+    }
+    position = iter;
+    return static_cast<std::uint32_t>(*size);
+}
+
+outcome<const_buffer_view> decode_bytes(
+        std::size_t size,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (std::distance(position, end) < static_cast<buffer_view::difference_type>(size)) {
+        return underflow();
+    }
+    const_buffer_view result { position, size };
+    position += size;
+    return result;
+}
+
+template<class T>
+outcome<T> decode_fixed(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    static_assert(std::is_integral_v<T>);
+    static_assert(std::is_unsigned_v<T>);
+    if (std::distance(position, end) < static_cast<buffer_view::difference_type>(sizeof(T))) {
+        return underflow();
+    }
+    T result { 0 };
+    for (std::size_t i = 1; i <= sizeof(T); ++i) {
+        T value { static_cast<unsigned char>(*position) };
+        result |= value << ((sizeof(T) - i) * 8U);
+        ++position;
+    }
+    return result;
+}
+
+std::optional<failure> decode_single(
+        entry_type type,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(type, position, end)) {
+        return reason;
+    }
+    ++position;
+    return std::nullopt;
+}
+
+outcome<std::int64_t> decode_int(buffer_view::const_iterator& position, buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(entry_type::int_, position, end)) {
+        return *reason;
+    }
     auto first = *position;
     if (auto value = extract(
             first,
@@ -184,7 +285,7 @@ std::int64_t read_int(buffer_view::const_iterator& position, buffer_view::const_
             mask_embed_positive_int,
             min_embed_positive_int_value)) {
         ++position;
-        return *value;
+        return std::int64_t { *value };
     }
     if (auto value = extract(
             first,
@@ -192,80 +293,103 @@ std::int64_t read_int(buffer_view::const_iterator& position, buffer_view::const_
             mask_embed_negative_int,
             min_embed_negative_int_value)) {
         ++position;
-        return *value;
+        return std::int64_t { *value };
     }
 
     BOOST_ASSERT(static_cast<unsigned char>(first) == header_int); // NOLINT
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto result = read_sint(iter, end);
-    position = iter;
-    return result;
-}
-
-float read_float4(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::float4, position, end);
-    buffer_view::const_iterator iter = position;
-    ++iter;
-
-    auto bits = read_fixed<std::uint32_t>(iter, end);
-    float result {};
-    std::memcpy(&result, &bits, sizeof(result));
-    position = iter;
+    auto result = decode_sint(iter, end);
+    if (result) {
+        position = iter;
+    }
     return result;
 }
 
-double read_float8(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::float8, position, end);
+template<class Float, class Bits>
+outcome<Float> decode_float(
+        entry_type type,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(type, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
 
-    auto bits = read_fixed<std::uint64_t>(iter, end);
-    double result {};
-    std::memcpy(&result, &bits, sizeof(result));
+    auto bits = decode_fixed<Bits>(iter, end);
+    if (!bits) {
+        return bits.error();
+    }
+    Float result {};
+    std::memcpy(&result, &*bits, sizeof(result));
     position = iter;
     return result;
 }
 
-static const_buffer_view read_decimal_coefficient(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    auto size = read_uint(position, end);
-    if (size == 0 || size > max_decimal_coefficient_size) {
-        throw_decimal_coefficient_out_of_range(size);
+outcome<const_buffer_view> decode_decimal_coefficient(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    auto iter = position;
+    auto size = decode_uint(iter, end);
+    if (!size) {
+        return size.error();
+    }
+    if (*size == 0 || *size > max_decimal_coefficient_size) {
+        return failure { failure::kind_type::decimal_coefficient_out_of_range, *size };
     }
-    auto bytes = read_bytes(size, position, end);
-    if (size != max_decimal_coefficient_size) {
+    auto bytes = decode_bytes(*size, iter, end);
+    if (!bytes) {
+        return bytes.error();
+    }
+    if (*size != max_decimal_coefficient_size) {
+        position = iter;
         return bytes;
     }
 
-    auto first = static_cast<std::uint8_t>(bytes[0]);
+    auto first = static_cast<std::uint8_t>((*bytes)[0]);
     // positive is OK because coefficient is [0, 2^128)
     if (first == 0) {
+        position = iter;
         return bytes;
     }
 
     if (first == 0xffU) {
         // check negative value to avoid -2^128 (0xff 0x00.. 0x00)
         auto const* found = std::find_if(
-                bytes.begin() + 1,
-                bytes.end(),
+                bytes->begin() + 1,
+                bytes->end(),
                 [](auto c) { return c != '\0'; });
-        if (found != bytes.end()) {
+        if (found != bytes->end()) {
+            position = iter;
             return bytes;
         }
     }
 
-    throw_decimal_coefficient_out_of_range(size);
+    return failure { failure::kind_type::decimal_coefficient_out_of_range, *size };
 }
 
-decimal::triple read_decimal(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+outcome<decimal::triple> decode_decimal(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    auto type = decode_type(position, end);
+    if (!type) {
+        return type.error();
+    }
+
     // int encoded
-    if (peek_type(position, end) == entry_type::int_) {
-        auto value = read_int(position, end);
-        return decimal::triple { value, 0 };
+    if (*type == entry_type::int_) {
+        auto value = decode_int(position, end);
+        if (!value) {
+            return value.error();
+        }
+        return decimal::triple { *value, 0 };
     }
 
     // decimal encoded
-    requires_entry(entry_type::decimal, position, end);
+    if (auto reason = check_entry(entry_type::decimal, position, end)) {
+        return *reason;
+    }
 
     buffer_view::const_iterator iter = position;
     auto first = static_cast<unsigned char>(*iter);
@@ -273,17 +397,30 @@ decimal::triple read_decimal(buffer_view::const_iterator& position, buffer_view:
 
     // compact decimal value
     if (first == header_decimal_compact) {
-        auto exponent = read_sint32(iter, end);
-        auto coefficient = read_sint(iter, end);
+        auto exponent = decode_sint32(iter, end);
+        if (!exponent) {
+            return exponent.error();
+        }
+        auto coefficient = decode_sint(iter, end);
+        if (!coefficient) {
+            return coefficient.error();
+        }
         position = iter;
-        return { coefficient, exponent };
+        return decimal::triple { *coefficient, *exponent };
     }
 
     // full decimal value
     BOOST_ASSERT(first == header_decimal); // NOLINT
 
-    auto exponent = read_sint32(iter, end);
-    auto coefficient = read_decimal_coefficient(iter, end);
+    auto exponent = decode_sint32(iter, end);
+    if (!exponent) {
+        return exponent.error();
+    }
+    auto decoded = decode_decimal_coefficient(iter, end);
+    if (!decoded) {
+        return decoded.error();
+    }
+    auto coefficient = *decoded;
 
     // extract lower 8-octets of coefficient
     std::uint64_t c_lo {};
@@ -336,166 +473,569 @@ decimal::triple read_decimal(buffer_view::const_iterator& position, buffer_view:
         negative ? -1 : +1,
         c_hi,
         c_lo,
-        exponent,
+        *exponent,
     };
 }
 
-std::string_view read_character(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::character, position, end);
+// decodes the header of character, octet, or bit entries
+outcome<std::size_t> decode_sized_header(
+        entry_type type,
+        std::uint32_t embed_header,
+        std::uint32_t embed_mask,
+        std::uint32_t embed_min,
+        [[maybe_unused]] std::uint32_t header,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(type, position, end)) {
+        return *reason;
+    }
+    auto first = *position;
+    if (auto value = extract(first, embed_header, embed_mask, embed_min)) {
+        ++position;
+        return std::size_t { *value };
+    }
+    BOOST_ASSERT(static_cast<unsigned char>(first) == header); // NOLINT
     buffer_view::const_iterator iter = position;
-    std::size_t size {};
-    auto first = *iter;
-    if (auto value = extract(
-            first,
-            header_embed_character,
-            mask_embed_character,
-            min_embed_character_size)) {
-        size = *value;
-        ++iter;
-    } else {
-        BOOST_ASSERT(static_cast<unsigned char>(first) == header_character); // NOLINT
-        ++iter;
-        size = read_size(iter, end);
+    ++iter;
+    auto size = decode_size(iter, end);
+    if (!size) {
+        return size.error();
     }
-
-    auto result = read_bytes(size, iter, end);
     position = iter;
-    return { result.data(), result.size() };
+    return std::size_t { *size };
 }
 
-std::string_view read_octet(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::octet, position, end);
+outcome<std::string_view> decode_sized_bytes(
+        entry_type type,
+        std::uint32_t embed_header,
+        std::uint32_t embed_mask,
+        std::uint32_t embed_min,
+        std::uint32_t header,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
     buffer_view::const_iterator iter = position;
-    std::size_t size {};
-    auto first = *iter;
-    if (auto value = extract(
-            first,
-            header_embed_octet,
-            mask_embed_octet,
-            min_embed_octet_size)) {
-        size = *value;
-        ++iter;
-    } else {
-        BOOST_ASSERT(static_cast<unsigned char>(first) == header_octet); // NOLINT
-        ++iter;
-        size = read_size(iter, end);
+    auto size = decode_sized_header(type, embed_header, embed_mask, embed_min, header, iter, end);
+    if (!size) {
+        return size.error();
+    }
+    auto result = decode_bytes(*size, iter, end);
+    if (!result) {
+        return result.error();
     }
-
-    auto result = read_bytes(size, iter, end);
     position = iter;
-    return { result.data(), result.size() };
+    return std::string_view { result->data(), result->size() };
 }
 
-const_bitset_view read_bit(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::bit, position, end);
+outcome<std::string_view> decode_character(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return decode_sized_bytes(
+            entry_type::character,
+            header_embed_character,
+            mask_embed_character,
+            min_embed_character_size,
+            header_character,
+            position,
+            end);
+}
+
+outcome<std::string_view> decode_octet(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return decode_sized_bytes(
+            entry_type::octet,
+            header_embed_octet,
+            mask_embed_octet,
+            min_embed_octet_size,
+            header_octet,
+            position,
+            end);
+}
+
+outcome<const_bitset_view> decode_bit(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
     buffer_view::const_iterator iter = position;
-    std::size_t size {};
-    auto first = *iter;
-    if (auto value = extract(
-            first,
+    auto size = decode_sized_header(
+            entry_type::bit,
             header_embed_bit,
             mask_embed_bit,
-            min_embed_bit_size)) {
-        size = *value;
-        ++iter;
-    } else {
-        BOOST_ASSERT(static_cast<unsigned char>(first) == header_bit); // NOLINT
-        ++iter;
-        size = read_size(iter, end);
+            min_embed_bit_size,
+            header_bit,
+            iter,
+            end);
+    if (!size) {
+        return size.error();
+    }
+    std::size_t block_size = (*size + 7) / 8;
+    auto result = decode_bytes(block_size, iter, end);
+    if (!result) {
+        return result.error();
     }
-
-    std::size_t block_size = (size + 7) / 8;
-    auto result = read_bytes(block_size, iter, end);
     position = iter;
-    return { result.data(), size };
+    return const_bitset_view { result->data(), *size };
 }
 
-datetime::date read_date(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end) {
-    requires_entry(entry_type::date, position, end);
+outcome<datetime::date> decode_date(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(entry_type::date, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto offset = read_sint(iter, end);
+    auto offset = decode_sint(iter, end);
+    if (!offset) {
+        return offset.error();
+    }
     position = iter;
-    return datetime::date { offset };
+    return datetime::date { *offset };
 }
 
-datetime::time_of_day read_time_of_day(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end) {
-    requires_entry(entry_type::time_of_day, position, end);
+outcome<datetime::time_of_day> decode_time_of_day(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(entry_type::time_of_day, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto offset = read_uint(iter, end);
+    auto offset = decode_uint(iter, end);
+    if (!offset) {
+        return offset.error();
+    }
     position = iter;
-    return datetime::time_of_day { datetime::time_of_day::time_unit { offset }};
+    return datetime::time_of_day { datetime::time_of_day::time_unit { *offset }};
 }
 
-datetime::time_point read_time_point(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end) {
-    requires_entry(entry_type::time_point, position, end);
+outcome<datetime::time_point> decode_time_point(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(entry_type::time_point, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto offset = read_sint(iter, end);
-    auto adjustment = read_uint(iter, end);
+    auto offset = decode_sint(iter, end);
+    if (!offset) {
+        return offset.error();
+    }
+    auto adjustment = decode_uint(iter, end);
+    if (!adjustment) {
+        return adjustment.error();
+    }
     position = iter;
     return datetime::time_point {
-            datetime::time_point::offset_type { offset },
-            datetime::time_point::subsecond_unit { adjustment },
+            datetime::time_point::offset_type { *offset },
+            datetime::time_point::subsecond_unit { *adjustment },
     };
 }
 
-datetime::datetime_interval read_datetime_interval(util::buffer_view::const_iterator& position, util::buffer_view::const_iterator end) {
-    requires_entry(entry_type::datetime_interval, position, end);
+outcome<datetime::datetime_interval> decode_datetime_interval(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(entry_type::datetime_interval, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto year = read_sint32(iter, end);
-    auto month = read_sint32(iter, end);
-    auto day = read_sint32(iter, end);
-    auto time = read_sint(iter, end);
+    auto year = decode_sint32(iter, end);
+    if (!year) {
+        return year.error();
+    }
+    auto month = decode_sint32(iter, end);
+    if (!month) {
+        return month.error();
+    }
+    auto day = decode_sint32(iter, end);
+    if (!day) {
+        return day.error();
+    }
+    auto time = decode_sint(iter, end);
+    if (!time) {
+        return time.error();
+    }
     position = iter;
     return datetime::datetime_interval {
-            { year, month, day },
-            datetime::time_interval { datetime::time_interval::time_unit { time } },
+            { *year, *month, *day },
+            datetime::time_interval { datetime::time_interval::time_unit { *time } },
     };
 }
 
-std::size_t read_array_begin(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::array, position, end);
-    auto first = *position;
-    if (auto size = extract(
-            first,
+outcome<std::size_t> decode_array_begin(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return decode_sized_header(
+            entry_type::array,
             header_embed_array,
             mask_embed_array,
-            min_embed_array_size)) {
-        ++position;
-        return *size;
-    }
+            min_embed_array_size,
+            header_array,
+            position,
+            end);
+}
 
-    BOOST_ASSERT(static_cast<unsigned char>(first) == header_array); // NOLINT
+outcome<std::size_t> decode_row_begin(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return decode_sized_header(
+            entry_type::row,
+            header_embed_row,
+            mask_embed_row,
+            min_embed_row_size,
+            header_row,
+            position,
+            end);
+}
+
+outcome<std::string_view> decode_lob(
+        entry_type type,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    if (auto reason = check_entry(type, position, end)) {
+        return *reason;
+    }
     buffer_view::const_iterator iter = position;
     ++iter;
-    auto size = read_size(iter, end);
+    auto size = decode_size(iter, end);
+    if (!size) {
+        return size.error();
+    }
+    auto result = decode_bytes(*size, iter, end);
+    if (!result) {
+        return result.error();
+    }
     position = iter;
-    return size;
+    return std::string_view { result->data(), result->size() };
+}
+
+template<class T>
+outcome<std::size_t> discard(outcome<T>&& result) noexcept {
+    if (!result) {
+        return result.error();
+    }
+    return std::size_t { 0 };
+}
+
+// skips the current entry, and returns the number of its elements which must be skipped after it
+outcome<std::size_t> skip_header(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    auto type = decode_type(position, end);
+    if (!type) {
+        return type.error();
+    }
+    switch (*type) {
+        case entry_type::int_: return discard(decode_int(position, end));
+        case entry_type::float4: return discard(decode_float<float, std::uint32_t>(*type, position, end));
+        case entry_type::float8: return discard(decode_float<double, std::uint64_t>(*type, position, end));
+        case entry_type::decimal: return discard(decode_decimal(position, end));
+        case entry_type::character: return discard(decode_character(position, end));
+        case entry_type::octet: return discard(decode_octet(position, end));
+        case entry_type::bit: return discard(decode_bit(position, end));
+        case entry_type::date: return discard(decode_date(position, end));
+        case entry_type::time_of_day: return discard(decode_time_of_day(position, end));
+        case entry_type::time_point: return discard(decode_time_point(position, end));
+        case entry_type::datetime_interval: return discard(decode_datetime_interval(position, end));
+        case entry_type::row: return decode_row_begin(position, end);
+        case entry_type::array: return decode_array_begin(position, end);
+        case entry_type::clob: return discard(decode_lob(*type, position, end));
+        case entry_type::blob: return discard(decode_lob(*type, position, end));
+        case entry_type::null:
+        case entry_type::end_of_contents:
+            ++position;
+            return std::size_t { 0 };
+    }
+    std::abort();
+}
+
+std::optional<failure> skip_entries(
+        std::size_t count,
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    buffer_view::const_iterator iter = position;
+    // nested rows and arrays just increase the number of rest entries, instead of recursion
+    for (std::size_t rest = count; rest > 0; --rest) {
+        auto nested = skip_header(iter, end);
+        if (!nested) {
+            return nested.error();
+        }
+        rest += *nested;
+    }
+    position = iter;
+    return std::nullopt;
+}
+
+} // namespace
+
+entry_type peek_type(buffer_view::const_iterator position, buffer_view::const_iterator end) {
+    return unwrap(decode_type(position, end));
+}
+
+void read_end_of_contents(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    if (auto reason = decode_single(entry_type::end_of_contents, position, end)) {
+        raise(*reason);
+    }
+}
+
+void read_null(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    if (auto reason = decode_single(entry_type::null, position, end)) {
+        raise(*reason);
+    }
+}
+
+std::int64_t read_int(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_int(position, end));
+}
+
+float read_float4(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_float<float, std::uint32_t>(entry_type::float4, position, end));
+}
+
+double read_float8(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_float<double, std::uint64_t>(entry_type::float8, position, end));
+}
+
+decimal::triple read_decimal(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_decimal(position, end));
+}
+
+std::string_view read_character(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_character(position, end));
+}
+
+std::string_view read_octet(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_octet(position, end));
+}
+
+const_bitset_view read_bit(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_bit(position, end));
+}
+
+datetime::date read_date(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_date(position, end));
+}
+
+datetime::time_of_day read_time_of_day(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_time_of_day(position, end));
+}
+
+datetime::time_point read_time_point(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_time_point(position, end));
+}
+
+datetime::datetime_interval read_datetime_interval(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_datetime_interval(position, end));
+}
+
+std::size_t read_array_begin(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_array_begin(position, end));
 }
 
 std::size_t read_row_begin(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
-    requires_entry(entry_type::row, position, end);
-    auto first = *position;
-    if (auto size = extract(
-            first,
-            header_embed_row,
-            mask_embed_row,
-            min_embed_row_size)) {
-        ++position;
-        return *size;
+    return unwrap(decode_row_begin(position, end));
+}
+
+std::string_view read_clob(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_lob(entry_type::clob, position, end));
+}
+
+std::string_view read_blob(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    return unwrap(decode_lob(entry_type::blob, position, end));
+}
+
+void skip_entry(buffer_view::const_iterator& position, buffer_view::const_iterator end) {
+    if (auto reason = skip_entries(1, position, end)) {
+        raise(*reason);
     }
+}
 
-    BOOST_ASSERT(static_cast<unsigned char>(first) == header_row); // NOLINT
+std::size_t index_elements(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end,
+        std::vector<std::size_t>& offsets) {
+    offsets.clear();
+    buffer_view::const_iterator start = position;
     buffer_view::const_iterator iter = position;
-    ++iter;
-    auto size = read_size(iter, end);
+    auto type = unwrap(decode_type(iter, end));
+    auto size = type == entry_type::array
+            ? unwrap(decode_array_begin(iter, end))
+            : unwrap(decode_row_begin(iter, end));
+    offsets.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        offsets.emplace_back(static_cast<std::size_t>(std::distance(start, iter)));
+        if (auto reason = skip_entries(1, iter, end)) {
+            offsets.clear();
+            raise(*reason);
+        }
+    }
     position = iter;
     return size;
 }
 
-// FIXME: impl blob, clob
+value_input_result<entry_type> try_peek_type(
+        buffer_view::const_iterator position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_type(position, end));
+}
+
+value_input_result<std::int64_t> try_read_int(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_int(position, end));
+}
+
+value_input_result<float> try_read_float4(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_float<float, std::uint32_t>(entry_type::float4, position, end));
+}
+
+value_input_result<double> try_read_float8(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_float<double, std::uint64_t>(entry_type::float8, position, end));
+}
+
+value_input_result<decimal::triple> try_read_decimal(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_decimal(position, end));
+}
+
+value_input_result<std::string_view> try_read_character(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_character(position, end));
+}
+
+value_input_result<std::string_view> try_read_octet(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_octet(position, end));
+}
+
+value_input_result<const_bitset_view> try_read_bit(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_bit(position, end));
+}
+
+value_input_result<datetime::date> try_read_date(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_date(position, end));
+}
+
+value_input_result<datetime::time_of_day> try_read_time_of_day(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_time_of_day(position, end));
+}
+
+value_input_result<datetime::time_point> try_read_time_point(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_time_point(position, end));
+}
+
+value_input_result<datetime::datetime_interval> try_read_datetime_interval(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_datetime_interval(position, end));
+}
+
+value_input_result<std::size_t> try_read_array_begin(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_array_begin(position, end));
+}
+
+value_input_result<std::size_t> try_read_row_begin(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_row_begin(position, end));
+}
+
+value_input_result<std::string_view> try_read_clob(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_lob(entry_type::clob, position, end));
+}
+
+value_input_result<std::string_view> try_read_blob(
+        buffer_view::const_iterator& position,
+        buffer_view::const_iterator end) noexcept {
+    return to_result(decode_lob(entry_type::blob, position, end));
+}
+
+std::size_t read_ints(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<std::int64_t> destination) {
+    std::int64_t* data = destination.data();
+    std::size_t size = destination.size();
+    std::size_t count = 0;
+    for (; count < size && position < end; ++count) {
+        auto first = *position;
+        std::int64_t& result = data[count]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (auto value = extract(
+                first,
+                header_embed_positive_int,
+                mask_embed_positive_int,
+                min_embed_positive_int_value)) {
+            result = *value;
+            ++position;
+        } else if (auto value = extract(
+                first,
+                header_embed_negative_int,
+                mask_embed_negative_int,
+                min_embed_negative_int_value)) {
+            result = *value;
+            ++position;
+        } else if (static_cast<unsigned char>(first) == header_int) {
+            buffer_view::const_iterator iter = position;
+            ++iter;
+            result = unwrap(decode_sint(iter, end));
+            position = iter;
+        } else {
+            break;
+        }
+    }
+    return count;
+}
+
+std::size_t read_float8s(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<double> destination) {
+    double* data = destination.data();
+    std::size_t size = destination.size();
+    std::size_t count = 0;
+    for (; count < size && position < end && static_cast<unsigned char>(*position) == header_float8; ++count) {
+        buffer_view::const_iterator iter = position;
+        ++iter;
+        auto bits = unwrap(decode_fixed<std::uint64_t>(iter, end));
+        std::memcpy(&data[count], &bits, sizeof(bits)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        position = iter;
+    }
+    return count;
+}
+
+std::size_t read_dates(
+        util::buffer_view::const_iterator& position,
+        util::buffer_view::const_iterator end,
+        util::sequence_view<datetime::date> destination) {
+    datetime::date* data = destination.data();
+    std::size_t size = destination.size();
+    std::size_t count = 0;
+    for (; count < size && position < end && static_cast<unsigned char>(*position) == header_date; ++count) {
+        buffer_view::const_iterator iter = position;
+        ++iter;
+        data[count] = datetime::date { unwrap(decode_sint(iter, end)) }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        position = iter;
+    }
+    return count;
+}
 
 } // namespace takatori::serializer
@@ -1,5 +1,6 @@
 #include <takatori/serializer/value_output.h>
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 #include <tuple>
@@ -268,30 +269,51 @@ bool write_decimal(
     return true;
 }
 
+[[nodiscard]] static std::size_t size_character_header(std::size_t size) noexcept {
+    if (min_embed_character_size <= size && size <= max_embed_character_size) {
+        return 1;
+    }
+    return 1 + base128v::size_unsigned(size);
+}
+
+[[nodiscard]] static std::size_t size_octet_header(std::size_t size) noexcept {
+    if (min_embed_octet_size <= size && size <= max_embed_octet_size) {
+        return 1;
+    }
+    return 1 + base128v::size_unsigned(size);
+}
+
 bool write_character(
         std::string_view value,
         buffer_view::iterator& position,
         buffer_view::const_iterator end) {
     auto size = value.size();
+    if (buffer_remaining(position, end) < size_character_header(size) + size) {
+        return false;
+    }
+    write_character_header(size, position, end);
+    write_bytes(value.data(), value.size(), position, end);
+    return true;
+}
 
+bool write_character_header(
+        std::size_t size,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    if (buffer_remaining(position, end) < size_character_header(size)) {
+        return false;
+    }
     if (min_embed_character_size <= size && size <= max_embed_character_size) {
         // for short character string
-        if (buffer_remaining(position, end) < 1 + size) {
-            return false;
-        }
         write_fixed8(
                 static_cast<std::int64_t>(header_embed_character) + size - min_embed_character_size,
                 position,
                 end);
     } else {
         // for long character string
-        if (buffer_remaining(position, end) < 1 + base128v::size_unsigned(size) + size) {
-            return false;
-        }
         write_fixed8(header_character, position, end);
         base128v::write_unsigned(size, position, end);
     }
-    write_bytes(value.data(), value.size(), position, end);
     return true;
 }
 
@@ -300,25 +322,32 @@ bool write_octet(
         buffer_view::iterator& position,
         buffer_view::const_iterator end) {
     auto size = value.size();
+    if (buffer_remaining(position, end) < size_octet_header(size) + size) {
+        return false;
+    }
+    write_octet_header(size, position, end);
+    write_bytes(value.data(), value.size(), position, end);
+    return true;
+}
 
+bool write_octet_header(
+        std::size_t size,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    if (buffer_remaining(position, end) < size_octet_header(size)) {
+        return false;
+    }
     if (min_embed_octet_size <= size && size <= max_embed_octet_size) {
         // for short octet string
-        if (buffer_remaining(position, end) < 1 + size) {
-            return false;
-        }
         write_fixed8(
                 static_cast<std::int64_t>(header_embed_octet) + size - min_embed_octet_size,
                 position,
                 end);
     } else {
         // for long octet string
-        if (buffer_remaining(position, end) < 1 + base128v::size_unsigned(size) + size) {
-            return false;
-        }
         write_fixed8(header_octet, position, end);
         base128v::write_unsigned(size, position, end);
     }
-    write_bytes(value.data(), value.size(), position, end);
     return true;
 }
 
@@ -479,4 +508,165 @@ bool write_row_begin(
     return true;
 }
 
+static bool write_lob_header(
+        std::uint32_t header,
+        std::size_t size,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    if (buffer_remaining(position, end) < 1 + base128v::size_unsigned(size)) {
+        return false;
+    }
+    write_fixed8(header, position, end);
+    base128v::write_unsigned(size, position, end);
+    return true;
+}
+
+static bool write_lob(
+        std::uint32_t header,
+        std::string_view value,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    auto size = value.size();
+    if (buffer_remaining(position, end) < 1 + base128v::size_unsigned(size) + size) {
+        return false;
+    }
+    write_lob_header(header, size, position, end);
+    write_bytes(value.data(), value.size(), position, end);
+    return true;
+}
+
+bool write_clob(
+        std::string_view value,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_lob(header_clob, value, position, end);
+}
+
+bool write_clob_header(
+        std::size_t size,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_lob_header(header_clob, size, position, end);
+}
+
+bool write_blob(
+        std::string_view value,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_lob(header_blob, value, position, end);
+}
+
+bool write_blob_header(
+        std::size_t size,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_lob_header(header_blob, size, position, end);
+}
+
+/// @brief the max size of `int` entry, or `date` entry: header + base128v encoded 64-bit integer.
+static constexpr std::size_t max_int_entry_size = 1 + base128v::size_unsigned(std::numeric_limits<std::uint64_t>::max());
+
+/// @brief the size of `float8` entry: header + 8 octets.
+static constexpr std::size_t float8_entry_size = 1 + 8;
+
+/**
+ * @brief writes a series of entries.
+ * @details This writes entries without checking the buffer for each entry while their worst case size fits in the
+ *      remaining buffer, and then writes the rest entries one by one until the buffer is exhausted.
+ */
+template<class T, class Unchecked, class Checked>
+static std::size_t write_series(
+        util::sequence_view<T const> values,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end,
+        std::size_t max_entry_size,
+        Unchecked&& unchecked,
+        Checked&& checked) {
+    T const* data = values.data();
+    std::size_t size = values.size();
+    std::size_t count = 0;
+    while (count < size) {
+        auto safe = std::min(size - count, buffer_remaining(position, end) / max_entry_size);
+        if (safe == 0) {
+            break;
+        }
+        for (std::size_t i = count, n = count + safe; i < n; ++i) {
+            unchecked(data[i], position, end); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        count += safe;
+    }
+    while (count < size && checked(data[count], position, end)) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ++count;
+    }
+    return count;
+}
+
+std::size_t write_ints(
+        util::sequence_view<std::int64_t const> values,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_series(
+            values,
+            position,
+            end,
+            max_int_entry_size,
+            [](std::int64_t value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                if (min_embed_positive_int_value <= value && value <= max_embed_positive_int_value) {
+                    write_fixed8(
+                            static_cast<std::int64_t>(header_embed_positive_int) + value - min_embed_positive_int_value,
+                            pos,
+                            e);
+                } else if (min_embed_negative_int_value <= value && value <= max_embed_negative_int_value) {
+                    write_fixed8(
+                            static_cast<std::int64_t>(header_embed_negative_int) + value - min_embed_negative_int_value,
+                            pos,
+                            e);
+                } else {
+                    write_fixed8(header_int, pos, e);
+                    base128v::write_signed(value, pos, e);
+                }
+            },
+            [](std::int64_t value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                return write_int(value, pos, e);
+            });
+}
+
+std::size_t write_float8s(
+        util::sequence_view<double const> values,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_series(
+            values,
+            position,
+            end,
+            float8_entry_size,
+            [](double value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                std::uint64_t bits {};
+                std::memcpy(&bits, &value, sizeof(bits));
+                write_fixed8(header_float8, pos, e);
+                write_fixed<std::uint64_t>(bits, pos, e);
+            },
+            [](double value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                return write_float8(value, pos, e);
+            });
+}
+
+std::size_t write_dates(
+        util::sequence_view<datetime::date const> values,
+        buffer_view::iterator& position,
+        buffer_view::const_iterator end) {
+    return write_series(
+            values,
+            position,
+            end,
+            max_int_entry_size,
+            [](datetime::date value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                write_fixed8(header_date, pos, e);
+                base128v::write_signed(value.days_since_epoch(), pos, e);
+            },
+            [](datetime::date value, buffer_view::iterator& pos, buffer_view::const_iterator e) {
+                return write_date(value, pos, e);
+            });
+}
+
 } // namespace takatori::serializer
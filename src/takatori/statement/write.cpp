@@ -1,6 +1,7 @@
 #include <takatori/statement/write.h>
 
 #include <takatori/util/downcast.h>
+#include <takatori/util/exception.h>
 #include <takatori/util/vector_print_support.h>
 
 #include <takatori/tree/tree_fragment_vector_forward.h>
@@ -41,7 +42,9 @@ write::write(util::clone_tag_t, write const& other) noexcept
             other.destination_,
             { other.columns_ },
             tree::forward(other.tuples_))
-{}
+{
+    block_ = other.block_;
+}
 
 write::write(util::clone_tag_t, write&& other) noexcept
     : write(
@@ -49,7 +52,9 @@ write::write(util::clone_tag_t, write&& other) noexcept
             std::move(other.destination_),
             { std::move(other.columns_) },
             tree::forward(std::move(other.tuples_)))
-{}
+{
+    block_ = std::move(other.block_);
+}
 
 statement_kind write::kind() const noexcept {
     return tag;
@@ -96,11 +101,42 @@ tree::tree_fragment_vector<write::tuple> const& write::tuples() const noexcept {
     return tuples_;
 }
 
+util::optional_ptr<scalar::literal_block const> write::block() const noexcept {
+    return util::optional_ptr { block_.get() };
+}
+
+write& write::block(std::shared_ptr<scalar::literal_block const> block) {
+    if (block && block->columns().size() != columns_.size()) {
+        util::throw_exception(std::invalid_argument("inconsistent number of block columns"));
+    }
+    block_ = std::move(block);
+    return *this;
+}
+
+write& write::materialize_block() {
+    if (!block_) {
+        return *this;
+    }
+    auto&& columns = block_->columns();
+    tuples_.reserve(tuples_.size() + block_->row_count());
+    for (std::size_t r = 0, n = block_->row_count(); r < n; ++r) {
+        util::reference_vector<scalar::expression> elements {};
+        elements.reserve(columns.size());
+        for (std::size_t c = 0, m = columns.size(); c < m; ++c) {
+            elements.push_back(block_->materialize(r, c));
+        }
+        tuples_.emplace_back(std::move(elements));
+    }
+    block_.reset();
+    return *this;
+}
+
 bool operator==(write const& a, write const& b) noexcept {
     return a.operator_kind() == b.operator_kind()
             && a.destination() == b.destination()
             && a.columns() == b.columns()
-            && a.tuples() == b.tuples();
+            && a.tuples() == b.tuples()
+            && a.block() == b.block();
 }
 
 bool operator!=(write const& a, write const& b) noexcept {
@@ -108,11 +144,15 @@ bool operator!=(write const& a, write const& b) noexcept {
 }
 
 std::ostream& operator<<(std::ostream& out, write const& value) {
-    return out << value.kind() << "("
+    out << value.kind() << "("
             << "operator_kind=" << value.operator_kind() << ", "
             << "destination=" << value.destination() << ", "
             << "columns=" << util::print_support { value.columns() } << ", "
-            << "tuples=" << value.tuples() << ")";
+            << "tuples=" << value.tuples();
+    if (auto block = value.block()) {
+        out << ", block=" << *block;
+    }
+    return out << ")";
 }
 
 bool write::equals(statement const& other) const noexcept {
@@ -0,0 +1,52 @@
+#include <takatori/type/repository.h>
+
+#include <takatori/util/clonable.h>
+
+namespace takatori::type {
+
+std::shared_ptr<data const> repository::get(data const& type) {
+    return find_or_insert(type, [&] {
+        return util::clone_shared(type);
+    });
+}
+
+std::shared_ptr<data const> repository::get(data&& type) {
+    return find_or_insert(type, [&] {
+        return util::clone_shared(std::move(type));
+    });
+}
+
+std::shared_ptr<data const> repository::get(std::shared_ptr<data const> type) {
+    if (!type) {
+        return {};
+    }
+    auto&& ref = *type;
+    return find_or_insert(ref, [&] {
+        return std::move(type);
+    });
+}
+
+repository::size_type repository::size() const {
+    std::lock_guard lock { mutex_ };
+    return entries_.size();
+}
+
+void repository::clear() {
+    std::lock_guard lock { mutex_ };
+    entries_.clear();
+}
+
+template<class Factory>
+std::shared_ptr<data const> repository::find_or_insert(data const& type, Factory&& factory) {
+    // a non-owning key for searching the entries
+    std::shared_ptr<data const> key { std::shared_ptr<void> {}, std::addressof(type) };
+    std::lock_guard lock { mutex_ };
+    if (auto iter = entries_.find(key); iter != entries_.end()) {
+        return *iter;
+    }
+    std::shared_ptr<data const> created = factory();
+    entries_.emplace(created);
+    return created;
+}
+
+} // namespace takatori::type
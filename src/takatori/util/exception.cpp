@@ -1,5 +1,7 @@
 #include <takatori/util/exception.h>
 
+#include <algorithm>
+#include <atomic>
 #include <ostream>
 
 #include <boost/exception/error_info.hpp>
@@ -11,17 +13,74 @@ namespace takatori::util {
 /// @brief extended error information about stacktrace.
 using stacktrace_info = ::boost::error_info<struct tag_stacktrace, boost::stacktrace::stacktrace>;
 
-void impl::attach_trace(boost::exception& exception, ::boost::stacktrace::stacktrace&& trace) {
-    exception << stacktrace_info { std::move(trace) };
+/// @brief extended error information about stacktrace, whose symbols should not be resolved in this process.
+using raw_stacktrace_info = ::boost::error_info<struct tag_raw_stacktrace, boost::stacktrace::stacktrace>;
+
+static std::atomic<stacktrace_policy> current_policy { stacktrace_policy::always }; // NOLINT
+
+static std::atomic_size_t sampling_interval { 100 }; // NOLINT
+
+static std::atomic_size_t sampling_counter { 0 }; // NOLINT
+
+static bool should_sample() noexcept {
+    auto interval = sampling_interval.load(std::memory_order_relaxed);
+    return sampling_counter.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+}
+
+void impl::attach_trace(boost::exception& exception) {
+    // skips this frame
+    static constexpr std::size_t skip = 1;
+    switch (current_policy.load(std::memory_order_relaxed)) {
+        case stacktrace_policy::always:
+            exception << stacktrace_info { ::boost::stacktrace::stacktrace { skip, static_cast<std::size_t>(-1) } };
+            return;
+        case stacktrace_policy::sampled:
+            if (should_sample()) {
+                exception << stacktrace_info { ::boost::stacktrace::stacktrace { skip, static_cast<std::size_t>(-1) } };
+            }
+            return;
+        case stacktrace_policy::raw_addresses:
+            exception << raw_stacktrace_info { ::boost::stacktrace::stacktrace { skip, static_cast<std::size_t>(-1) } };
+            return;
+        case stacktrace_policy::never:
+            return;
+    }
 }
 
 ::boost::stacktrace::stacktrace const* find_trace(std::exception const& exception) {
-    return ::boost::get_error_info<stacktrace_info>(exception);
+    if (auto const* st = ::boost::get_error_info<stacktrace_info>(exception); st != nullptr) {
+        return st;
+    }
+    return ::boost::get_error_info<raw_stacktrace_info>(exception);
 }
 
 void print_trace(std::ostream& out, std::exception const& exception) {
-    if (auto const* st = find_trace(exception); st != nullptr) {
+    if (auto const* st = ::boost::get_error_info<stacktrace_info>(exception); st != nullptr) {
         out << *st;
+        return;
+    }
+    if (auto const* st = ::boost::get_error_info<raw_stacktrace_info>(exception); st != nullptr) {
+        std::size_t index = 0;
+        for (auto&& frame : *st) {
+            out << index++ << "# " << frame.address() << '\n';
+        }
     }
 }
+
+void set_stacktrace_policy(stacktrace_policy policy) noexcept {
+    current_policy.store(policy, std::memory_order_relaxed);
+}
+
+stacktrace_policy get_stacktrace_policy() noexcept {
+    return current_policy.load(std::memory_order_relaxed);
+}
+
+void set_stacktrace_sampling_interval(std::size_t interval) noexcept {
+    sampling_interval.store(std::max(interval, std::size_t { 1 }), std::memory_order_relaxed);
+}
+
+std::size_t get_stacktrace_sampling_interval() noexcept {
+    return sampling_interval.load(std::memory_order_relaxed);
+}
+
 } // namespace takatori::util
@@ -0,0 +1,71 @@
+#include <takatori/util/object_memory.h>
+
+#include <new>
+
+namespace takatori::util {
+
+namespace {
+
+thread_local std::pmr::memory_resource* current_resource = nullptr; // NOLINT
+
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+
+/**
+ * @brief the header of individual object storage.
+ */
+struct alignas(std::max_align_t) object_header {
+    std::pmr::memory_resource* resource;
+    std::size_t size;
+};
+
+static_assert(sizeof(object_header) % alignof(std::max_align_t) == 0);
+
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+} // namespace
+
+std::pmr::memory_resource* object_memory_resource() noexcept {
+    return current_resource;
+}
+
+object_memory_scope::object_memory_scope(std::pmr::memory_resource* resource) noexcept
+    : previous_(current_resource)
+{
+    current_resource = resource;
+}
+
+object_memory_scope::~object_memory_scope() {
+    current_resource = previous_;
+}
+
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+
+void* object_memory_support::operator new(std::size_t size) {
+    std::size_t total = sizeof(object_header) + size;
+    auto* resource = current_resource;
+    // uses the global allocation function directly, to avoid virtual calls for the default resource
+    auto* storage = resource != nullptr
+            ? resource->allocate(total, alignof(std::max_align_t))
+            : ::operator new(total);
+    auto* header = ::new(storage) object_header { resource, total };
+    return header + 1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+void object_memory_support::operator delete(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    auto* header = static_cast<object_header*>(pointer) - 1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* resource = header->resource;
+    auto size = header->size;
+    header->~object_header();
+    if (resource == nullptr) {
+        ::operator delete(header);
+        return;
+    }
+    resource->deallocate(header, size, alignof(std::max_align_t));
+}
+
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+} // namespace takatori::util
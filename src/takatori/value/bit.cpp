@@ -1,5 +1,7 @@
 #include <takatori/value/bit.h>
 
+#include <boost/iterator/function_output_iterator.hpp>
+
 #include <takatori/util/exception.h>
 
 namespace takatori::value {
@@ -49,13 +51,12 @@ bool bit::equals(data const& other) const noexcept {
 }
 
 std::size_t bit::hash() const noexcept {
-    constexpr auto nbits = sizeof(block_type) * 8;
+    static_assert(sizeof(block_type) == sizeof(std::size_t));
+    // NOTE: folds the individual blocks, the unused bits in the last block are always 0
     std::size_t result = 0;
-    for (entity_type::size_type i = 0, n = entity_.size(); i < n; ++i) {
-        if (entity_[i]) {
-            result ^= static_cast<std::size_t>(1) << (i % nbits);
-        }
-    }
+    boost::to_block_range(entity_, boost::iterators::make_function_output_iterator([&](block_type block) {
+        result ^= static_cast<std::size_t>(block);
+    }));
     result = result * 31 + entity_.size();
     return result;
 }
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string_view>
+#include <vector>
 
 namespace takatori::datetime {
 
@@ -211,4 +213,68 @@ TEST_F(datetime_conversion_test, parse_zone_offset_invalid_form) {
     EXPECT_FALSE(parse_zone_offset("12:34:56"));
 }
 
+TEST_F(datetime_conversion_test, parse_dates) {
+    std::vector<std::string_view> contents {
+            "1970-01-01",
+            "2024-09-16",
+            "1-1-1",
+    };
+    std::vector<date> results(contents.size());
+    EXPECT_EQ(parse_dates(contents, results), 3);
+    EXPECT_EQ(results[0], date(1970, 1, 1));
+    EXPECT_EQ(results[1], date(2024, 9, 16));
+    EXPECT_EQ(results[2], date(1, 1, 1));
+}
+
+TEST_F(datetime_conversion_test, parse_dates_invalid) {
+    std::vector<std::string_view> contents {
+            "1970-01-01",
+            "1970-13-01",
+            "2024-09-16",
+    };
+    std::vector<date> results(contents.size());
+    EXPECT_EQ(parse_dates(contents, results), 1);
+    EXPECT_EQ(results[0], date(1970, 1, 1));
+}
+
+TEST_F(datetime_conversion_test, parse_times) {
+    std::vector<std::string_view> contents {
+            "00:00:00",
+            "12:34:56.789",
+            "23:59:59.999999999",
+    };
+    std::vector<time_of_day> results(contents.size());
+    EXPECT_EQ(parse_times(contents, results), 3);
+    EXPECT_EQ(results[0], time_of_day(0, 0, 0));
+    EXPECT_EQ(results[1], time_of_day(12, 34, 56, std::chrono::milliseconds(789)));
+    EXPECT_EQ(results[2], time_of_day(23, 59, 59, std::chrono::nanoseconds(999'999'999)));
+}
+
+TEST_F(datetime_conversion_test, parse_datetimes) {
+    std::vector<std::string_view> contents {
+            "1970-01-02",
+            "1970-01-02 12:34:56.789",
+            "1970-01-02T12:34:56Z",
+            "1970-01-02 12:34:56+09:00",
+            "1970-01-02 12:34:56-01:30",
+    };
+    std::vector<time_point> results(contents.size());
+    EXPECT_EQ(parse_datetimes(contents, results), 5);
+    EXPECT_EQ(results[0], time_point(date(1970, 1, 2)));
+    EXPECT_EQ(results[1], time_point(date(1970, 1, 2), time_of_day(12, 34, 56, std::chrono::milliseconds(789))));
+    EXPECT_EQ(results[2], time_point(date(1970, 1, 2), time_of_day(12, 34, 56)));
+    EXPECT_EQ(results[3], time_point(date(1970, 1, 2), time_of_day(3, 34, 56)));
+    EXPECT_EQ(results[4], time_point(date(1970, 1, 2), time_of_day(14, 4, 56)));
+}
+
+TEST_F(datetime_conversion_test, parse_datetimes_short) {
+    std::vector<std::string_view> contents {
+            "1970-01-01",
+            "1970-01-02",
+    };
+    std::vector<time_point> results(1);
+    EXPECT_EQ(parse_datetimes(contents, results), 1);
+    EXPECT_EQ(results[0], time_point(date(1970, 1, 1)));
+}
+
 } // namespace takatori::datetime
@@ -0,0 +1,146 @@
+#include <takatori/datetime/parser/canonical_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <takatori/datetime/parser/parser.h>
+
+namespace takatori::datetime::parser {
+
+using subsecond_type = time_info::subsecond_type;
+
+class datetime_canonical_parser_test : public ::testing::Test {
+protected:
+    static bool equals(parser_result_info const& a, parser_result_info const& b) {
+        if (a.date.has_value() != b.date.has_value()
+                || a.time.has_value() != b.time.has_value()
+                || a.offset.has_value() != b.offset.has_value()) {
+            return false;
+        }
+        if (a.date && (a.date->year != b.date->year || a.date->month != b.date->month || a.date->day != b.date->day)) {
+            return false;
+        }
+        if (a.time && (a.time->hour != b.time->hour
+                || a.time->minute != b.time->minute
+                || a.time->second != b.time->second
+                || a.time->subsecond != b.time->subsecond)) {
+            return false;
+        }
+        if (a.offset && (a.offset->plus != b.offset->plus
+                || a.offset->hour != b.offset->hour
+                || a.offset->minute != b.offset->minute)) {
+            return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(datetime_canonical_parser_test, date) {
+    auto r = parse_canonical("2024-09-16");
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->date);
+    EXPECT_EQ(r->date->year, 2024);
+    EXPECT_EQ(r->date->month, 9);
+    EXPECT_EQ(r->date->day, 16);
+
+    EXPECT_FALSE(r->time);
+    EXPECT_FALSE(r->offset);
+}
+
+TEST_F(datetime_canonical_parser_test, time) {
+    auto r = parse_canonical("12:34:56");
+    ASSERT_TRUE(r);
+    EXPECT_FALSE(r->date);
+    ASSERT_TRUE(r->time);
+    EXPECT_EQ(r->time->hour, 12);
+    EXPECT_EQ(r->time->minute, 34);
+    EXPECT_EQ(r->time->second, 56);
+    EXPECT_EQ(r->time->subsecond, subsecond_type(0));
+    EXPECT_FALSE(r->offset);
+}
+
+TEST_F(datetime_canonical_parser_test, time_subsecond) {
+    auto r = parse_canonical("12:34:56.789");
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->time);
+    EXPECT_EQ(r->time->subsecond, subsecond_type(789'000'000));
+
+    r = parse_canonical("12:34:56.000000001");
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->time);
+    EXPECT_EQ(r->time->subsecond, subsecond_type(1));
+}
+
+TEST_F(datetime_canonical_parser_test, datetime) {
+    auto r = parse_canonical("2024-09-16T12:34:56.789+09:30");
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->date);
+    EXPECT_EQ(r->date->year, 2024);
+    EXPECT_EQ(r->date->month, 9);
+    EXPECT_EQ(r->date->day, 16);
+
+    ASSERT_TRUE(r->time);
+    EXPECT_EQ(r->time->hour, 12);
+    EXPECT_EQ(r->time->minute, 34);
+    EXPECT_EQ(r->time->second, 56);
+    EXPECT_EQ(r->time->subsecond, subsecond_type(789'000'000));
+
+    ASSERT_TRUE(r->offset);
+    EXPECT_TRUE(r->offset->plus);
+    EXPECT_EQ(r->offset->hour, 9);
+    EXPECT_EQ(r->offset->minute, 30);
+}
+
+TEST_F(datetime_canonical_parser_test, offset) {
+    auto r = parse_canonical("Z");
+    ASSERT_TRUE(r);
+    EXPECT_FALSE(r->date);
+    EXPECT_FALSE(r->time);
+    ASSERT_TRUE(r->offset);
+    EXPECT_TRUE(r->offset->plus);
+    EXPECT_EQ(r->offset->hour, 0);
+    EXPECT_EQ(r->offset->minute, 0);
+
+    r = parse_canonical("-12");
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->offset);
+    EXPECT_FALSE(r->offset->plus);
+    EXPECT_EQ(r->offset->hour, 12);
+    EXPECT_EQ(r->offset->minute, 0);
+}
+
+TEST_F(datetime_canonical_parser_test, not_canonical) {
+    EXPECT_FALSE(parse_canonical(""));
+    EXPECT_FALSE(parse_canonical("1-1-1"));
+    EXPECT_FALSE(parse_canonical("2024-9-16"));
+    EXPECT_FALSE(parse_canonical("2024-09-16 "));
+    EXPECT_FALSE(parse_canonical("2024-09-16_12:34:56"));
+    EXPECT_FALSE(parse_canonical("0:0:0"));
+    EXPECT_FALSE(parse_canonical("12:34:56."));
+    EXPECT_FALSE(parse_canonical("12:34:56.0000000001"));
+    EXPECT_FALSE(parse_canonical("12:34:56+0900"));
+    EXPECT_FALSE(parse_canonical("12:34:56+09:00x"));
+    EXPECT_FALSE(parse_canonical("YYYY-MM-DD"));
+}
+
+TEST_F(datetime_canonical_parser_test, consistent) {
+    for (std::string_view contents : {
+            "1970-01-01",
+            "9999-12-31",
+            "00:00:00",
+            "23:59:59.999999999",
+            "12:34:56.7Z",
+            "1970-01-02 12:34:56",
+            "1970-01-02T12:34:56.789-01:30",
+            "1970-01-02 12:34:56+09",
+            "+00:00",
+            "Z",
+    }) {
+        auto fast = parse_canonical(contents);
+        ASSERT_TRUE(fast) << contents;
+        auto slow = parse(contents);
+        ASSERT_TRUE(slow) << contents;
+        EXPECT_TRUE(equals(*fast, slow.value())) << contents;
+    }
+}
+
+} // namespace takatori::datetime::parser
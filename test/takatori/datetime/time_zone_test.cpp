@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace takatori::datetime {
 
 class time_zone_test : public ::testing::Test {};
@@ -88,4 +90,60 @@ TEST_F(time_zone_test, output) {
     std::cout << tz << std::endl;
 }
 
+TEST_F(time_zone_test, cached) {
+    time_zone a { "Asia/Tokyo" };
+    time_zone b { "Asia/Tokyo" };
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.name(), b.name());
+
+    time_zone c { +9h };
+    time_zone d { +9h };
+    EXPECT_EQ(c, d);
+}
+
+TEST_F(time_zone_test, offset_at) {
+    time_zone tz { "America/New_York" };
+    EXPECT_EQ(tz.offset_at(time_point { date { 2024, 1, 15 } }), -5h);
+    EXPECT_EQ(tz.offset_at(time_point { date { 2024, 7, 15 } }), -4h);
+
+    // 2024-03-10 02:00 EST -> 03:00 EDT
+    EXPECT_EQ(tz.offset_at(time_point { date { 2024, 3, 10 }, time_of_day { 6, 59, 59 } }), -5h);
+    EXPECT_EQ(tz.offset_at(time_point { date { 2024, 3, 10 }, time_of_day { 7, 0, 0 } }), -4h);
+
+    // out of the pre-computed range
+    EXPECT_EQ(tz.offset_at(time_point { date { 2200, 1, 15 } }), -5h);
+    EXPECT_EQ(tz.offset_at(time_point { date { 2200, 7, 15 } }), -4h);
+}
+
+TEST_F(time_zone_test, offset_at_fixed) {
+    EXPECT_EQ(time_zone::UTC.offset_at(time_point { date { 2024, 7, 15 } }), 0h);
+    EXPECT_EQ(time_zone { +9h }.offset_at(time_point { date { 2024, 7, 15 } }), +9h);
+    EXPECT_EQ(time_zone { -90min }.offset_at(time_point {}), -90min);
+}
+
+TEST_F(time_zone_test, to_local) {
+    time_zone tz { "America/New_York" };
+    EXPECT_EQ(
+            tz.to_local(time_point { date { 2024, 7, 15 }, time_of_day { 12, 0, 0 } }),
+            time_point(date { 2024, 7, 15 }, time_of_day { 8, 0, 0 }));
+}
+
+TEST_F(time_zone_test, to_local_batch) {
+    time_zone tz { "America/New_York" };
+    std::vector<time_point> source {
+            time_point { date { 2024, 1, 15 } },
+            time_point { date { 2024, 1, 16 } },
+            time_point { date { 2024, 7, 15 } },
+            time_point { date { 2200, 7, 15 } },
+            time_point { date { 2024, 1, 17 } },
+    };
+    std::vector<time_point> destination(source.size());
+    tz.to_local(source, destination);
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        EXPECT_EQ(destination[i], tz.to_local(source[i])) << i;
+    }
+    std::vector<time_point> shorter(source.size() - 1);
+    EXPECT_THROW(tz.to_local(source, shorter), std::invalid_argument);
+}
+
 } // namespace takatori::datetime
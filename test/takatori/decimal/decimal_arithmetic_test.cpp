@@ -0,0 +1,107 @@
+#include <takatori/decimal/arithmetic.h>
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace takatori::decimal {
+
+class decimal_arithmetic_test : public ::testing::Test {};
+
+// 10^38 - 1
+static constexpr triple max_value { +1, 0x4B3B'4CA8'5A86'C47AULL, 0x098A'223F'FFFF'FFFFULL, 0 };
+
+TEST_F(decimal_arithmetic_test, compare) {
+    EXPECT_EQ(compare(triple { 1 }, triple { 1 }), 0);
+    EXPECT_EQ(compare(triple { 10, -1 }, triple { 1 }), 0);
+    EXPECT_LT(compare(triple { 1 }, triple { 2 }), 0);
+    EXPECT_GT(compare(triple { 2 }, triple { 1 }), 0);
+    EXPECT_LT(compare(triple { -2 }, triple { 1 }), 0);
+    EXPECT_GT(compare(triple { -1 }, triple { -2 }), 0);
+    EXPECT_LT(compare(triple {}, triple { 1 }), 0);
+    EXPECT_EQ(compare(triple { 0, 0, 0, 5 }, triple {}), 0);
+    EXPECT_GT(compare(triple { 1, 100 }, max_value), 0);
+    EXPECT_LT(compare(triple { -1, 100 }, max_value), 0);
+    EXPECT_LT(compare(triple { 1, -100 }, triple { 1, -99 }), 0);
+}
+
+TEST_F(decimal_arithmetic_test, add) {
+    EXPECT_EQ(try_add(triple { 1 }, triple { 2 }), triple { 3 });
+    EXPECT_EQ(try_add(triple { 314, -2 }, triple { 1 }), (triple { 414, -2 }));
+    EXPECT_EQ(try_add(triple { 1 }, triple { -3 }), triple { -2 });
+    EXPECT_EQ(try_add(triple { 5, -1 }, triple { -5, -1 }), (triple { 0, -1 }));
+    EXPECT_EQ(try_add(triple {}, triple { 25, -1 }), (triple { 25, -1 }));
+    EXPECT_EQ(try_add(max_value, triple { -1 }), (triple { +1, 0x4B3B'4CA8'5A86'C47AULL, 0x098A'223F'FFFF'FFFEULL, 0 }));
+    EXPECT_FALSE(try_add(max_value, triple { 1 }));
+    EXPECT_FALSE(try_add(triple { 1, 38 }, triple { 1 }));
+}
+
+TEST_F(decimal_arithmetic_test, subtract) {
+    EXPECT_EQ(try_subtract(triple { 3 }, triple { 2 }), triple { 1 });
+    EXPECT_EQ(try_subtract(triple { 2 }, triple { 3 }), triple { -1 });
+    EXPECT_EQ(try_subtract(triple { 1 }, triple { 1, -1 }), (triple { 9, -1 }));
+    EXPECT_FALSE(try_subtract(max_value, triple { -1 }));
+    EXPECT_EQ(subtract(triple { 3 }, triple { 5 }), triple { -2 });
+}
+
+TEST_F(decimal_arithmetic_test, multiply) {
+    EXPECT_EQ(try_multiply(triple { 3 }, triple { 4 }), triple { 12 });
+    EXPECT_EQ(try_multiply(triple { 15, -1 }, triple { -2 }), (triple { -30, -1 }));
+    EXPECT_EQ(try_multiply(triple {}, triple { 7, -3 }), (triple { 0, -3 }));
+    EXPECT_EQ(try_multiply(triple { 1'000'000'000'000'000'000LL }, triple { 1'000'000'000'000'000'000LL }),
+            (triple { +1, 0x00C0'97CE'7BC9'0715ULL, 0xB34B'9F10'0000'0000ULL, 0 }));
+    EXPECT_FALSE(try_multiply(max_value, triple { 2 }));
+    EXPECT_FALSE(try_multiply(triple { 1, std::numeric_limits<std::int32_t>::max() }, triple { 1, 1 }));
+    EXPECT_EQ(multiply(triple { 6 }, triple { 7 }), triple { 42 });
+}
+
+TEST_F(decimal_arithmetic_test, rescale) {
+    EXPECT_EQ(rescale(triple { 1 }, -2), (triple { 100, -2 }));
+    EXPECT_EQ(rescale(triple { 12345, -3 }, -1, rounding_mode::down), (triple { 123, -1 }));
+    EXPECT_EQ(rescale(triple { 12345, -3 }, -2, rounding_mode::half_up), (triple { 1235, -2 }));
+    EXPECT_EQ(rescale(triple { 12345, -3 }, -2, rounding_mode::half_even), (triple { 1234, -2 }));
+    EXPECT_EQ(rescale(triple { 12355, -3 }, -2, rounding_mode::half_even), (triple { 1236, -2 }));
+    EXPECT_EQ(rescale(triple { -12346, -3 }, -2, rounding_mode::half_even), (triple { -1235, -2 }));
+    EXPECT_EQ(rescale(triple { 4, -1 }, 0, rounding_mode::half_up), (triple { 0, 0 }));
+    EXPECT_EQ(rescale(triple { 5, -1 }, 0, rounding_mode::half_up), (triple { 1, 0 }));
+    EXPECT_EQ(rescale(triple { 5, -1 }, 100), (triple { 0, 100 }));
+    EXPECT_FALSE(rescale(max_value, -1));
+}
+
+TEST_F(decimal_arithmetic_test, round) {
+    EXPECT_EQ(round(triple { 31415, -4 }, 2), (triple { 314, -2 }));
+    EXPECT_EQ(round(triple { 31415, -4 }, 3, rounding_mode::half_up), (triple { 3142, -3 }));
+    EXPECT_EQ(round(triple { 314, -2 }, 4), (triple { 314, -2 }));
+    EXPECT_EQ(round(triple { 1250 }, -2), (triple { 12, 2 }));
+}
+
+TEST_F(decimal_arithmetic_test, sum) {
+    std::vector<triple> values {
+            triple { 1 },
+            triple { 25, -1 },
+            triple { -125, -2 },
+    };
+    EXPECT_EQ(sum(values), (triple { 225, -2 }));
+    EXPECT_EQ(sum({}), triple {});
+}
+
+TEST_F(decimal_arithmetic_test, batch) {
+    std::vector<triple> left { triple { 1 }, triple { 2 }, triple { 3 } };
+    std::vector<triple> right { triple { 10 }, triple { 20 }, triple { 30 } };
+    std::vector<triple> results(3);
+
+    add(left, right, results);
+    EXPECT_EQ(results, (std::vector<triple> { triple { 11 }, triple { 22 }, triple { 33 } }));
+
+    subtract(left, right, results);
+    EXPECT_EQ(results, (std::vector<triple> { triple { -9 }, triple { -18 }, triple { -27 } }));
+
+    multiply(left, right, results);
+    EXPECT_EQ(results, (std::vector<triple> { triple { 10 }, triple { 40 }, triple { 90 } }));
+
+    std::vector<triple> small(2);
+    EXPECT_THROW(add(left, right, small), std::invalid_argument);
+}
+
+} // namespace takatori::decimal
@@ -0,0 +1,112 @@
+#include <takatori/descriptor/table.h>
+
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <takatori/descriptor/variable.h>
+#include <takatori/testing/mock_binding_info.h>
+
+namespace takatori::descriptor {
+
+class descriptor_table_test : public ::testing::Test {};
+
+using takatori::testing::mock_binding_info;
+using info = mock_binding_info<variable::tag, int>;
+
+static_assert(std::is_trivially_copyable_v<handle<variable::tag>>);
+static_assert(sizeof(handle<variable::tag>) <= 2 * sizeof(void*));
+
+TEST_F(descriptor_table_test, simple) {
+    table<variable::tag> t {};
+    variable d { std::make_shared<info>(1) };
+    auto h = t.add(d);
+    ASSERT_FALSE(h.empty());
+    EXPECT_EQ(h.id(), 0);
+    EXPECT_EQ(h.owner().get(), &t);
+    EXPECT_EQ(h.descriptor(), d);
+    EXPECT_EQ(h.entity(), d.entity());
+    EXPECT_EQ(h.reference(), d.reference());
+    EXPECT_EQ(t.size(), 1);
+}
+
+TEST_F(descriptor_table_test, intern) {
+    table<variable::tag> t {};
+    auto a = t.add(variable { std::make_shared<info>(1) });
+    auto b = t.add(variable { std::make_shared<info>(1) });
+    auto c = t.add(variable { std::make_shared<info>(2) });
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(t.size(), 2);
+
+    std::hash<handle<variable::tag>> hasher {};
+    EXPECT_EQ(hasher(a), hasher(b));
+}
+
+TEST_F(descriptor_table_test, empty) {
+    table<variable::tag> t {};
+    auto a = t.add(variable { std::shared_ptr<info> {} });
+    handle<variable::tag> b {};
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a, b);
+    EXPECT_FALSE(a.optional_entity());
+    EXPECT_EQ(a.reference(), variable::reference_type {});
+    EXPECT_EQ(t.size(), 0);
+}
+
+TEST_F(descriptor_table_test, find) {
+    table<variable::tag> t {};
+    auto a = t.add(variable { std::make_shared<info>(1) });
+    EXPECT_EQ(t.find(variable { std::make_shared<info>(1) }), a);
+    EXPECT_TRUE(t.find(variable { std::make_shared<info>(2) }).empty());
+}
+
+TEST_F(descriptor_table_test, different_table) {
+    table<variable::tag> t0 {};
+    table<variable::tag> t1 {};
+    variable d { std::make_shared<info>(1) };
+    EXPECT_NE(t0.add(d), t1.add(d));
+}
+
+TEST_F(descriptor_table_test, many) {
+    table<variable::tag> t {};
+    std::vector<handle<variable::tag>> handles {};
+    for (int i = 0; i < 10'000; ++i) {
+        handles.emplace_back(t.add(variable { std::make_shared<info>(i) }));
+    }
+    EXPECT_EQ(t.size(), 10'000);
+    for (int i = 0; i < 10'000; ++i) {
+        auto&& h = handles[static_cast<std::size_t>(i)];
+        EXPECT_EQ(h.id(), static_cast<std::uint32_t>(i));
+        EXPECT_EQ(h.descriptor(), variable { std::make_shared<info>(i) });
+    }
+}
+
+TEST_F(descriptor_table_test, concurrent) {
+    table<variable::tag> t {};
+    std::vector<std::vector<handle<variable::tag>>> results(4);
+    std::vector<std::thread> threads {};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 1'000; ++j) {
+                auto h = t.add(variable { std::make_shared<info>(j) });
+                if (h.descriptor() != variable { std::make_shared<info>(j) }) {
+                    return;
+                }
+                results[i].emplace_back(h);
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(t.size(), 1'000);
+    for (auto&& result : results) {
+        EXPECT_EQ(result, results[0]);
+    }
+}
+
+} // namespace takatori::descriptor
@@ -112,6 +112,42 @@ TEST_F(graph_test, contains) {
     EXPECT_FALSE(g.contains(other.emplace(100)));
 }
 
+TEST_F(graph_test, ordinal) {
+    simple_graph g;
+    auto&& v1 = g.emplace(100);
+    auto&& v2 = g.emplace(200);
+    auto&& v3 = g.emplace(300);
+
+    EXPECT_EQ(g.ordinal(v1), 0);
+    EXPECT_EQ(g.ordinal(v2), 1);
+    EXPECT_EQ(g.ordinal(v3), 2);
+
+    simple_graph other;
+    EXPECT_EQ(g.ordinal(other.emplace(100)), simple_graph::npos);
+
+    g.erase(v1);
+    EXPECT_EQ(g.ordinal(v2), 0);
+    EXPECT_EQ(g.ordinal(v3), 1);
+}
+
+TEST_F(graph_test, iterate_order) {
+    simple_graph g;
+    for (int i = 0; i < 100; ++i) {
+        g.emplace(i);
+    }
+    g.erase(*g.find(*std::next(g.begin(), 50)));
+
+    int expect = 0;
+    for (auto&& v : g) {
+        if (expect == 50) {
+            ++expect;
+        }
+        EXPECT_EQ(v.value(), expect);
+        ++expect;
+    }
+    EXPECT_EQ(expect, 100);
+}
+
 TEST_F(graph_test, empty) {
     simple_graph mg;
     auto&& g = std::as_const(mg);
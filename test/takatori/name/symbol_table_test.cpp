@@ -0,0 +1,115 @@
+#include <takatori/name/symbol_table.h>
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace takatori::name {
+
+class symbol_table_test : public ::testing::Test {};
+
+TEST_F(symbol_table_test, intern) {
+    symbol_table table {};
+    auto a = table.intern("a");
+    auto b = table.intern("b");
+    auto a2 = table.intern(std::string { "a" });
+
+    EXPECT_EQ(a, a2);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a.token(), "a");
+    EXPECT_EQ(b.token(), "b");
+    EXPECT_EQ(a.id(), 0);
+    EXPECT_EQ(b.id(), 1);
+    EXPECT_EQ(a.hash(), std::hash<std::string_view> {}("a"));
+    EXPECT_EQ(a.owner(), &table);
+    EXPECT_EQ(table.size(), 2);
+}
+
+TEST_F(symbol_table_test, find) {
+    symbol_table table {};
+    auto a = table.intern("a");
+
+    EXPECT_EQ(table.find("a"), a);
+    EXPECT_FALSE(table.find("b"));
+    EXPECT_EQ(table.size(), 1);
+}
+
+TEST_F(symbol_table_test, identifier) {
+    symbol_table table {};
+    identifier id { "x" };
+
+    auto interned = table.intern_identifier(id);
+    EXPECT_TRUE(interned.interned_symbol());
+    EXPECT_EQ(interned.token(), "x");
+
+    EXPECT_EQ(interned, id);
+    EXPECT_EQ(interned, table.intern_identifier(identifier { "x" }));
+    EXPECT_NE(interned, table.intern_identifier(identifier { "y" }));
+    EXPECT_EQ(std::hash<identifier> {}(interned), std::hash<identifier> {}(id));
+    EXPECT_FALSE(interned < id);
+    EXPECT_FALSE(id < interned);
+
+    auto copy = interned;
+    EXPECT_EQ(copy.interned_symbol(), interned.interned_symbol());
+
+    copy.token("z");
+    EXPECT_FALSE(copy.interned_symbol());
+    EXPECT_EQ(copy.token(), "z");
+}
+
+TEST_F(symbol_table_test, identifier_different_tables) {
+    symbol_table t1 {};
+    symbol_table t2 {};
+
+    auto a = t1.intern_identifier(identifier { "a" });
+    auto b = t2.intern_identifier(identifier { "a" });
+    EXPECT_NE(a.interned_symbol(), b.interned_symbol());
+    EXPECT_EQ(a, b);
+}
+
+TEST_F(symbol_table_test, name) {
+    symbol_table table {};
+    name n { "a", "b", "c" };
+
+    auto interned = table.intern_name(n);
+    ASSERT_EQ(interned.size(), 3);
+    for (auto&& id : interned) {
+        EXPECT_TRUE(id.interned_symbol());
+    }
+    EXPECT_EQ(interned, n);
+    EXPECT_EQ(std::hash<name> {}(interned), std::hash<name> {}(n));
+    EXPECT_EQ(table.size(), 3);
+
+    std::unordered_set<name> set {};
+    set.emplace(interned);
+    EXPECT_NE(set.find(n), set.end());
+}
+
+TEST_F(symbol_table_test, concurrent) {
+    symbol_table table {};
+    std::vector<std::vector<symbol>> results(4);
+    std::vector<std::thread> threads {};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i] {
+            for (std::size_t j = 0; j < 100; ++j) {
+                results[i].emplace_back(table.intern(std::to_string(j)));
+            }
+        });
+    }
+    for (auto&& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(table.size(), 100);
+    for (std::size_t i = 1; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], results[0]);
+    }
+}
+
+TEST_F(symbol_table_test, global) {
+    auto a = symbol_table::global().intern("symbol_table_test.global");
+    EXPECT_EQ(a, symbol_table::global().intern("symbol_table_test.global"));
+}
+
+} // namespace takatori::name
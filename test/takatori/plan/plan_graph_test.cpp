@@ -1,12 +1,25 @@
 #include <takatori/plan/graph.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include <takatori/scalar/compare.h>
+#include <takatori/scalar/variable_reference.h>
+
 #include <takatori/relation/filter.h>
 
 #include <takatori/plan/process.h>
 #include <takatori/plan/forward.h>
 
+#include <takatori/util/object_memory.h>
+
 #include "test_utils.h"
 
 namespace takatori::plan {
@@ -41,6 +54,20 @@ process& find_bottom(graph_type& g) {
     std::abort();
 }
 
+/**
+ * @brief an executor which runs each task on a new thread.
+ */
+void run_on_threads(std::size_t count, std::function<void(std::size_t)> const& task) {
+    std::vector<std::thread> threads {};
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        threads.emplace_back([&task, i] { task(i); });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+}
+
 TEST_F(plan_graph_test, simple) {
     graph::graph<step> g;
     auto&& p = g.emplace<process>();
@@ -98,6 +125,61 @@ TEST_F(plan_graph_test, sort_rev) {
     EXPECT_EQ(r[2], std::addressof(s0));
 }
 
+TEST_F(plan_graph_test, adjacent_view) {
+    graph::graph<step> g;
+    auto&& s0 = g.emplace<process>();
+    auto&& s1 = g.emplace<forward>();
+    auto&& s2 = g.emplace<process>();
+
+    s0 >> s1;
+    s1 >> s2;
+
+    auto v0 = upstreams(s0);
+    EXPECT_TRUE(v0.empty());
+    EXPECT_EQ(v0.begin(), v0.end());
+
+    auto v1 = upstreams(s1);
+    ASSERT_EQ(v1.size(), 1);
+    EXPECT_EQ(std::addressof(*v1.begin()), std::addressof(s0));
+
+    step const& cs1 = s1;
+    auto v2 = downstreams(cs1);
+    ASSERT_EQ(v2.size(), 1);
+    EXPECT_EQ(std::addressof(*v2.begin()), std::addressof(s2));
+
+    auto v3 = downstreams(s0);
+    std::vector<step*> r;
+    for (auto&& s : v3) {
+        r.emplace_back(std::addressof(s));
+    }
+    ASSERT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0], std::addressof(s1));
+}
+
+TEST_F(plan_graph_test, sorted_view) {
+    graph::graph<step> g;
+    auto&& s2 = g.emplace<process>();
+    auto&& s1 = g.emplace<forward>();
+    auto&& s0 = g.emplace<process>();
+
+    s0 >> s1;
+    s1 >> s2;
+
+    std::vector<step const*> r;
+    graph_type const& cg = g;
+    for (auto&& s : sorted_from_upstream(cg)) {
+        r.emplace_back(std::addressof(s));
+    }
+    ASSERT_EQ(r.size(), 3);
+    EXPECT_EQ(r[0], std::addressof(s0));
+    EXPECT_EQ(r[1], std::addressof(s1));
+    EXPECT_EQ(r[2], std::addressof(s2));
+
+    std::vector<step const*> e;
+    sort_from_upstream(cg, const_consumer_type { [&](step const& s) { e.emplace_back(std::addressof(s)); } });
+    EXPECT_EQ(r, e);
+}
+
 TEST_F(plan_graph_test, merge_copy) {
     graph::graph<step> g;
     auto&& s0 = g.emplace<process>();
@@ -122,6 +204,130 @@ TEST_F(plan_graph_test, merge_copy) {
     ASSERT_EQ(t2.downstreams().size(), 0);
 }
 
+TEST_F(plan_graph_test, merge_parallel) {
+    graph::graph<step> g;
+    std::vector<process*> processes {};
+    for (std::size_t i = 0; i < 10; ++i) {
+        auto&& p = g.emplace<process>();
+        auto&& r0 = p.operators().insert(relation::filter { constant(static_cast<int>(i)) });
+        auto&& r1 = p.operators().insert(relation::filter { constant(static_cast<int>(i) + 100) });
+        r0.output() >> r1.input();
+        processes.emplace_back(std::addressof(p));
+    }
+    for (std::size_t i = 1; i < processes.size(); ++i) {
+        auto&& f = g.emplace<forward>();
+        *processes[i - 1] >> f;
+        f >> *processes[i];
+    }
+
+    graph::graph<step> h;
+    merge_into(g, h, 4);
+
+    ASSERT_EQ(h.size(), g.size());
+    EXPECT_EQ(compute_fingerprint(h), compute_fingerprint(g));
+
+    auto&& t0 = find_top(h);
+    EXPECT_EQ(t0.operators().size(), 2);
+    EXPECT_NE(std::addressof(t0), processes[0]);
+    EXPECT_EQ(find_bottom(h).downstreams().size(), 0);
+
+    graph::graph<step> serial;
+    merge_into(g, serial, 1);
+    EXPECT_EQ(compute_fingerprint(serial), compute_fingerprint(g));
+}
+
+TEST_F(plan_graph_test, merge_parallel_large) {
+    graph::graph<step> g;
+    for (std::size_t i = 0; i < 8; ++i) {
+        auto&& p = g.emplace<process>();
+        relation::expression* last = nullptr;
+        for (std::size_t j = 0; j < 100; ++j) {
+            auto&& r = p.operators().insert(relation::filter { constant(static_cast<int>(i * 100 + j)) });
+            if (last != nullptr) {
+                last->output_ports()[0] >> r.input();
+            }
+            last = std::addressof(r);
+        }
+    }
+
+    graph::graph<step> h;
+    merge_into(g, h, 4);
+    ASSERT_EQ(h.size(), g.size());
+    EXPECT_EQ(compute_fingerprint(h), compute_fingerprint(g));
+}
+
+TEST_F(plan_graph_test, merge_executor) {
+    graph::graph<step> g;
+    std::vector<process*> processes {};
+    for (std::size_t i = 0; i < 10; ++i) {
+        auto&& p = g.emplace<process>();
+        p.operators().insert(relation::filter { constant(static_cast<int>(i)) });
+        processes.emplace_back(std::addressof(p));
+    }
+    for (std::size_t i = 1; i < processes.size(); ++i) {
+        auto&& f = g.emplace<forward>();
+        *processes[i - 1] >> f;
+        f >> *processes[i];
+    }
+
+    std::size_t tasks = 0;
+    graph::graph<step> h;
+    merge_into(g, h, [&](std::size_t count, std::function<void(std::size_t)> const& task) {
+        tasks = count;
+        run_on_threads(count, task);
+    });
+    EXPECT_EQ(tasks, processes.size());
+    ASSERT_EQ(h.size(), g.size());
+    EXPECT_EQ(compute_fingerprint(h), compute_fingerprint(g));
+}
+
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+
+TEST_F(plan_graph_test, merge_parallel_memory) {
+    class counting_resource : public std::pmr::memory_resource {
+    public:
+        std::atomic_size_t allocated {};
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocated;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(memory_resource const& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    graph::graph<step> g;
+    for (std::size_t i = 0; i < 10; ++i) {
+        auto&& p = g.emplace<process>();
+        p.operators().insert(relation::filter { constant(static_cast<int>(i)) });
+    }
+
+    counting_resource serial_resource {};
+    graph::graph<step> serial;
+    {
+        util::object_memory_scope scope { &serial_resource };
+        merge_into(g, serial, 1);
+    }
+    counting_resource parallel_resource {};
+    graph::graph<step> parallel;
+    {
+        util::object_memory_scope scope { &parallel_resource };
+        merge_into(g, parallel, run_on_threads);
+    }
+    // the worker threads also allocate the operators from the resource
+    EXPECT_GT(serial_resource.allocated.load(), g.size());
+    EXPECT_EQ(parallel_resource.allocated.load(), serial_resource.allocated.load());
+}
+
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+
 TEST_F(plan_graph_test, merge_move) {
     graph::graph<step> g;
     auto&& s0 = g.emplace<process>();
@@ -142,4 +348,126 @@ TEST_F(plan_graph_test, merge_move) {
     EXPECT_TRUE(s1.has_downstream(s2));
 }
 
+TEST_F(plan_graph_test, fingerprint) {
+    graph::graph<step> g;
+    {
+        auto&& s0 = g.emplace<process>();
+        auto&& s1 = g.emplace<forward>();
+        auto&& s2 = g.emplace<process>();
+        s0.operators().insert(relation::filter { constant(1) });
+        s2.operators().insert(relation::filter { constant(2) });
+        s0 >> s1;
+        s1 >> s2;
+    }
+    graph::graph<step> h;
+    {
+        auto&& s2 = h.emplace<process>();
+        auto&& s1 = h.emplace<forward>();
+        auto&& s0 = h.emplace<process>();
+        s0.operators().insert(relation::filter { constant(1) });
+        s2.operators().insert(relation::filter { constant(2) });
+        s0 >> s1;
+        s1 >> s2;
+    }
+    EXPECT_EQ(compute_fingerprint(g), compute_fingerprint(h));
+
+    graph::graph<step> copy;
+    merge_into(g, copy);
+    EXPECT_EQ(compute_fingerprint(g), compute_fingerprint(copy));
+}
+
+TEST_F(plan_graph_test, fingerprint_literals) {
+    graph::graph<step> g;
+    {
+        auto&& s0 = g.emplace<process>();
+        auto&& s1 = g.emplace<forward>();
+        s0.operators().insert(relation::filter { constant(1) });
+        s0 >> s1;
+    }
+    graph::graph<step> h;
+    {
+        auto&& s0 = h.emplace<process>();
+        auto&& s1 = h.emplace<forward>();
+        s0.operators().insert(relation::filter { constant(2) });
+        s0 >> s1;
+    }
+    EXPECT_NE(compute_fingerprint(g), compute_fingerprint(h));
+    EXPECT_EQ(compute_fingerprint(g, true), compute_fingerprint(h, true));
+}
+
+TEST_F(plan_graph_test, fingerprint_descriptors) {
+    auto build = [](bool share) {
+        auto c0 = vardesc(0);
+        auto c1 = share ? c0 : vardesc(1);
+        auto g = std::make_unique<graph::graph<step>>();
+        auto&& s0 = g->emplace<process>();
+        auto&& s1 = g->emplace<forward>(std::vector { c0, c1 });
+        auto&& s2 = g->emplace<process>();
+        s0.operators().insert(relation::filter { scalar::variable_reference { c0 } });
+        s2.operators().insert(relation::filter { scalar::variable_reference { c1 } });
+        s0 >> s1;
+        s1 >> s2;
+        return g;
+    };
+    // built from different descriptor objects
+    auto g0 = build(false);
+    auto g1 = build(false);
+    EXPECT_EQ(compute_fingerprint(*g0), compute_fingerprint(*g1));
+    EXPECT_EQ(compute_fingerprint(*g0, true), compute_fingerprint(*g1, true));
+
+    auto g2 = build(true);
+    EXPECT_NE(compute_fingerprint(*g0), compute_fingerprint(*g2));
+}
+
+TEST_F(plan_graph_test, fingerprint_branch_order) {
+    // process{c0} -> forward{c0, c1} -> (process{c1 == c0}, process{c0})
+    auto build = [](std::array<std::size_t, 4> const& order, bool swap) {
+        auto c0 = vardesc(0);
+        auto c1 = vardesc(1);
+        auto g = std::make_unique<graph::graph<step>>();
+        std::array<step*, 4> ss {};
+        for (auto index : order) {
+            switch (index) {
+                case 0: {
+                    auto&& s = g->emplace<process>();
+                    s.operators().insert(relation::filter { scalar::variable_reference { c0 } });
+                    ss[0] = &s;
+                    break;
+                }
+                case 1:
+                    ss[1] = &g->emplace<forward>(std::vector { c0, c1 });
+                    break;
+                case 2: {
+                    auto&& s = g->emplace<process>();
+                    s.operators().insert(relation::filter {
+                            scalar::compare {
+                                    scalar::comparison_operator::equal,
+                                    scalar::variable_reference { swap ? c0 : c1 },
+                                    scalar::variable_reference { swap ? c1 : c0 },
+                            },
+                    });
+                    ss[2] = &s;
+                    break;
+                }
+                default: {
+                    auto&& s = g->emplace<process>();
+                    s.operators().insert(relation::filter { scalar::variable_reference { c0 } });
+                    ss[3] = &s;
+                    break;
+                }
+            }
+        }
+        *util::downcast<process>(ss[0]) >> *util::downcast<forward>(ss[1]);
+        *util::downcast<forward>(ss[1]) >> *util::downcast<process>(ss[2]);
+        *util::downcast<forward>(ss[1]) >> *util::downcast<process>(ss[3]);
+        return g;
+    };
+    std::array<std::size_t, 4> order { 0, 1, 2, 3 };
+    auto expect = compute_fingerprint(*build(order, false));
+    while (std::next_permutation(order.begin(), order.end())) {
+        EXPECT_EQ(compute_fingerprint(*build(order, false)), expect);
+    }
+    EXPECT_NE(compute_fingerprint(*build(order, true)), expect);
+}
+
 } // namespace takatori::plan
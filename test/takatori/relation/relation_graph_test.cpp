@@ -1,8 +1,16 @@
 #include <takatori/relation/graph.h>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <takatori/relation/filter.h>
+#include <takatori/relation/buffer.h>
+
+#include <takatori/scalar/compare.h>
+#include <takatori/scalar/variable_reference.h>
 
 #include "test_utils.h"
 
@@ -20,6 +28,45 @@ static graph_type release(
     return relation::release(source, es);
 }
 
+/**
+ * @brief builds a branching graph: filter{a} -> buffer{2} -> (filter{b == a}, filter{a}).
+ * @param order the insertion order of the vertices
+ * @param swap whether or not swaps the operands of `b == a`
+ * @return the built graph
+ */
+static graph_type build_branch(std::array<std::size_t, 4> const& order, bool swap = false) {
+    auto a = vardesc(1);
+    auto b = vardesc(2);
+    graph_type g;
+    std::array<expression*, 4> vs {};
+    for (auto index : order) {
+        switch (index) {
+            case 0:
+                vs[0] = &g.insert(filter { scalar::variable_reference { a } });
+                break;
+            case 1:
+                vs[1] = &g.insert(buffer { 2 });
+                break;
+            case 2:
+                vs[2] = &g.insert(filter {
+                        scalar::compare {
+                                scalar::comparison_operator::equal,
+                                scalar::variable_reference { swap ? a : b },
+                                scalar::variable_reference { swap ? b : a },
+                        },
+                });
+                break;
+            default:
+                vs[3] = &g.insert(filter { scalar::variable_reference { a } });
+                break;
+        }
+    }
+    vs[0]->output_ports()[0] >> vs[1]->input_ports()[0];
+    vs[1]->output_ports()[0] >> vs[2]->input_ports()[0];
+    vs[1]->output_ports()[1] >> vs[3]->input_ports()[0];
+    return g;
+}
+
 TEST_F(relation_graph_test, merge_simple) {
     graph_type g0;
     graph_type g1;
@@ -122,4 +169,168 @@ TEST_F(relation_graph_test, release_partial) {
     EXPECT_EQ(r2.output().opposite().get(), &r3.input());
 }
 
+TEST_F(relation_graph_test, adjacent_view) {
+    graph_type g;
+    auto&& r0 = g.insert(filter { constant(1) });
+    auto&& r1 = g.insert(filter { constant(2) });
+    auto&& r2 = g.insert(filter { constant(3) });
+
+    r0.output() >> r1.input();
+
+    EXPECT_TRUE(upstreams(r0).empty());
+    EXPECT_TRUE(downstreams(r1).empty());
+    EXPECT_TRUE(upstreams(r2).empty());
+
+    r1.output() >> r2.input();
+
+    std::vector<expression*> ups {};
+    for (auto&& e : upstreams(r1)) {
+        ups.emplace_back(std::addressof(e));
+    }
+    ASSERT_EQ(ups.size(), 1);
+    EXPECT_EQ(ups[0], std::addressof(r0));
+
+    auto const& cr1 = r1;
+    std::vector<expression const*> downs {};
+    for (auto&& e : downstreams(cr1)) {
+        downs.emplace_back(std::addressof(e));
+    }
+    ASSERT_EQ(downs.size(), 1);
+    EXPECT_EQ(downs[0], std::addressof(r2));
+}
+
+TEST_F(relation_graph_test, sorted_from_upstream) {
+    graph_type g;
+    auto&& r2 = g.insert(filter { constant(3) });
+    auto&& r0 = g.insert(filter { constant(1) });
+    auto&& r1 = g.insert(filter { constant(2) });
+    auto&& r3 = g.insert(filter { constant(4) });
+
+    r0.output() >> r1.input();
+    r1.output() >> r2.input();
+
+    std::vector<expression*> expect {};
+    sort_from_upstream(g, consumer_type { [&](expression& e) { expect.emplace_back(std::addressof(e)); } });
+    ASSERT_EQ(expect.size(), 4);
+
+    std::vector<expression*> templated {};
+    sort_from_upstream(g, [&](expression& e) { templated.emplace_back(std::addressof(e)); });
+    EXPECT_EQ(templated, expect);
+
+    std::vector<expression const*> lazy {};
+    graph_type const& cg = g;
+    for (auto&& e : sorted_from_upstream(cg)) {
+        lazy.emplace_back(std::addressof(e));
+    }
+    ASSERT_EQ(lazy.size(), 4);
+    EXPECT_EQ(lazy[0], std::addressof(r0));
+    EXPECT_EQ(lazy[1], std::addressof(r1));
+    EXPECT_EQ(lazy[2], std::addressof(r2));
+    EXPECT_EQ(lazy[3], std::addressof(r3));
+    EXPECT_TRUE(std::equal(lazy.begin(), lazy.end(), expect.begin(), expect.end()));
+
+    std::vector<expression*> rev {};
+    for (auto&& e : sorted_from_downstream(g)) {
+        rev.emplace_back(std::addressof(e));
+    }
+    ASSERT_EQ(rev.size(), 4);
+    EXPECT_EQ(rev[0], std::addressof(r2));
+    EXPECT_EQ(rev[1], std::addressof(r1));
+    EXPECT_EQ(rev[2], std::addressof(r0));
+    EXPECT_EQ(rev[3], std::addressof(r3));
+}
+
+TEST_F(relation_graph_test, fingerprint) {
+    graph_type g0;
+    {
+        auto&& r0 = g0.insert(filter { constant(1) });
+        auto&& r1 = g0.insert(filter { constant(2) });
+        auto&& r2 = g0.insert(filter { constant(3) });
+        r0.output() >> r1.input();
+        r1.output() >> r2.input();
+    }
+    graph_type g1;
+    {
+        auto&& r2 = g1.insert(filter { constant(3) });
+        auto&& r1 = g1.insert(filter { constant(2) });
+        auto&& r0 = g1.insert(filter { constant(1) });
+        r0.output() >> r1.input();
+        r1.output() >> r2.input();
+    }
+    graph_type g2;
+    {
+        auto&& r0 = g2.insert(filter { constant(1) });
+        auto&& r1 = g2.insert(filter { constant(3) });
+        auto&& r2 = g2.insert(filter { constant(2) });
+        r0.output() >> r1.input();
+        r1.output() >> r2.input();
+    }
+    EXPECT_EQ(compute_fingerprint(g0), compute_fingerprint(g1));
+    EXPECT_NE(compute_fingerprint(g0), compute_fingerprint(g2));
+    EXPECT_EQ(compute_fingerprint(g0, true), compute_fingerprint(g2, true));
+}
+
+TEST_F(relation_graph_test, fingerprint_connection) {
+    graph_type g0;
+    {
+        auto&& r0 = g0.insert(filter { constant(1) });
+        auto&& r1 = g0.insert(filter { constant(1) });
+        auto&& r2 = g0.insert(filter { constant(1) });
+        r0.output() >> r1.input();
+        r1.output() >> r2.input();
+    }
+    graph_type g1;
+    {
+        auto&& r0 = g1.insert(filter { constant(1) });
+        auto&& r1 = g1.insert(filter { constant(1) });
+        g1.insert(filter { constant(1) });
+        r0.output() >> r1.input();
+    }
+    EXPECT_NE(compute_fingerprint(g0), compute_fingerprint(g1));
+}
+
+TEST_F(relation_graph_test, fingerprint_descriptors_order) {
+    auto build = [](bool reverse) {
+        auto a = vardesc(1);
+        auto b = vardesc(2);
+        graph_type g;
+        auto add_a = [&] {
+            g.insert(filter { scalar::variable_reference { a } });
+        };
+        auto add_b = [&] {
+            g.insert(filter {
+                    scalar::compare {
+                            scalar::comparison_operator::equal,
+                            scalar::variable_reference { b },
+                            scalar::variable_reference { a },
+                    },
+            });
+        };
+        if (reverse) {
+            add_b();
+            add_a();
+        } else {
+            add_a();
+            add_b();
+        }
+        return g;
+    };
+    auto g0 = build(false);
+    auto g1 = build(true);
+    EXPECT_EQ(compute_fingerprint(g0), compute_fingerprint(g1));
+}
+
+TEST_F(relation_graph_test, fingerprint_branch_order) {
+    std::array<std::size_t, 4> order { 0, 1, 2, 3 };
+    auto expect = compute_fingerprint(build_branch(order));
+    while (std::next_permutation(order.begin(), order.end())) {
+        EXPECT_EQ(compute_fingerprint(build_branch(order)), expect);
+    }
+
+    // different usage of descriptors
+    std::array<std::size_t, 4> reversed { 3, 2, 1, 0 };
+    EXPECT_NE(compute_fingerprint(build_branch(reversed, true)), expect);
+    EXPECT_EQ(compute_fingerprint(build_branch(reversed, true), true), compute_fingerprint(build_branch(order, true), true));
+}
+
 } // namespace takatori::relation
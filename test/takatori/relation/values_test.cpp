@@ -6,6 +6,9 @@
 
 #include "test_utils.h"
 
+#include <takatori/type/primitive.h>
+#include <takatori/value/primitive.h>
+
 #include <takatori/util/clonable.h>
 
 namespace takatori::relation {
@@ -134,6 +137,61 @@ TEST_F(values_test, clone_move) {
     EXPECT_EQ(*copy, *move);
 }
 
+TEST_F(values_test, block) {
+    scalar::literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::int4>(),
+    }};
+    block.add_row(value::int4(1), value::int4(2));
+    block.add_row(value::int4(3), value::int4(4));
+
+    values expr {
+            {
+                    vardesc(1),
+                    vardesc(2),
+            },
+            {},
+    };
+    expr.block(std::make_shared<scalar::literal_block>(std::move(block)));
+    EXPECT_EQ(expr.rows().size(), 0);
+    ASSERT_TRUE(expr.block());
+    EXPECT_EQ(expr.block()->row_count(), 2);
+
+    auto copy = util::clone_unique(expr);
+    EXPECT_EQ(expr, *copy);
+    EXPECT_EQ(expr.block().get(), copy->block().get());
+
+    copy->materialize_block();
+    EXPECT_FALSE(copy->block());
+    EXPECT_TRUE(expr.block());
+    EXPECT_EQ(*copy, (values {
+            {
+                    vardesc(1),
+                    vardesc(2),
+            },
+            {
+                    { constant(1), constant(2), },
+                    { constant(3), constant(4), },
+            },
+    }));
+    EXPECT_EQ(copy->rows()[1].elements()[0].parent_element(), copy.get());
+}
+
+TEST_F(values_test, block_inconsistent) {
+    values expr {
+            {
+                    vardesc(1),
+                    vardesc(2),
+            },
+            {},
+    };
+    auto block = std::make_shared<scalar::literal_block>(std::vector<std::shared_ptr<type::data const>> {
+            std::make_shared<type::int4>(),
+    });
+    EXPECT_THROW(expr.block(block), std::invalid_argument);
+    EXPECT_FALSE(expr.block());
+}
+
 TEST_F(values_test, output) {
     values expr {
             {
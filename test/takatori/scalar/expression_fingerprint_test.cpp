@@ -0,0 +1,127 @@
+#include <takatori/scalar/expression.h>
+
+#include <memory>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <takatori/scalar/binary.h>
+#include <takatori/scalar/compare.h>
+#include <takatori/scalar/conditional.h>
+#include <takatori/scalar/function_call.h>
+#include <takatori/scalar/let.h>
+#include <takatori/scalar/unary.h>
+
+#include <takatori/util/clonable.h>
+
+#include "test_utils.h"
+
+namespace takatori::scalar {
+
+class expression_fingerprint_test : public ::testing::Test {};
+
+TEST_F(expression_fingerprint_test, simple) {
+    binary a { binary_operator::add, varref(1), constant(2) };
+    binary b { binary_operator::add, varref(1), constant(2) };
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+    EXPECT_EQ(std::hash<expression> {}(a), std::hash<expression> {}(b));
+}
+
+TEST_F(expression_fingerprint_test, different) {
+    binary a { binary_operator::add, varref(1), constant(2) };
+    binary b { binary_operator::subtract, varref(1), constant(2) };
+    binary c { binary_operator::add, varref(1), constant(3) };
+    binary d { binary_operator::add, constant(2), varref(1) };
+    compare e { comparison_operator::equal, varref(1), constant(2) };
+    EXPECT_NE(a.fingerprint(), b.fingerprint());
+    EXPECT_NE(a.fingerprint(), c.fingerprint());
+    EXPECT_NE(a.fingerprint(), d.fingerprint());
+    EXPECT_NE(a.fingerprint(), e.fingerprint());
+}
+
+TEST_F(expression_fingerprint_test, complex) {
+    conditional a {
+            {
+                    conditional::alternative { varref(1), constant(1) },
+            },
+            constant(2),
+    };
+    conditional b {
+            {
+                    conditional::alternative { varref(1), constant(1) },
+                    conditional::alternative { constant(2), constant(2) },
+            },
+    };
+    let c {
+            let::declarator { vardesc(1), constant(2) },
+            function_call { funcdesc(1), { varref(1) } },
+    };
+    let d {
+            let::declarator { vardesc(1), constant(2) },
+            function_call { funcdesc(2), { varref(1) } },
+    };
+    std::unordered_set<util::fingerprint> fingerprints {
+            a.fingerprint(),
+            b.fingerprint(),
+            c.fingerprint(),
+            d.fingerprint(),
+    };
+    EXPECT_EQ(fingerprints.size(), 4);
+
+    auto copy = util::clone_unique(c);
+    EXPECT_EQ(copy->fingerprint(), c.fingerprint());
+}
+
+TEST_F(expression_fingerprint_test, modify_property) {
+    binary a { binary_operator::add, varref(1), unary { unary_operator::plus, constant(2) } };
+    binary b { binary_operator::add, varref(1), unary { unary_operator::sign_inversion, constant(2) } };
+    auto fa = a.fingerprint();
+    ASSERT_NE(fa, b.fingerprint());
+
+    auto&& operand = static_cast<unary&>(a.right());
+    operand.operator_kind(unary_operator::sign_inversion);
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+
+    operand.operator_kind(unary_operator::plus);
+    EXPECT_EQ(a.fingerprint(), fa);
+}
+
+TEST_F(expression_fingerprint_test, modify_member) {
+    binary a { binary_operator::add, varref(1), constant(2) };
+    binary b { binary_operator::add, varref(1), constant(3) };
+    auto fa = a.fingerprint();
+    ASSERT_NE(fa, b.fingerprint());
+
+    a.right(util::clone_unique(constant(3)));
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+
+    auto released = a.release_right();
+    a.right(std::move(released));
+    EXPECT_EQ(a.fingerprint(), b.fingerprint());
+
+    function_call c { funcdesc(1), { varref(1), constant(2) } };
+    function_call d { funcdesc(1), { varref(1) } };
+    ASSERT_NE(c.fingerprint(), d.fingerprint());
+    c.arguments().pop_back();
+    EXPECT_EQ(c.fingerprint(), d.fingerprint());
+}
+
+TEST_F(expression_fingerprint_test, deep) {
+    std::unique_ptr<expression> a = util::clone_unique(varref(1));
+    std::unique_ptr<expression> b = util::clone_unique(varref(1));
+    for (std::size_t i = 0; i < 100'000; ++i) {
+        a = std::make_unique<unary>(unary_operator::plus, std::move(a));
+        b = std::make_unique<unary>(unary_operator::plus, std::move(b));
+    }
+    EXPECT_EQ(a->fingerprint(), b->fingerprint());
+
+    // avoid recursive destruction
+    while (auto* expr = dynamic_cast<unary*>(a.get())) {
+        a = expr->release_operand();
+    }
+    while (auto* expr = dynamic_cast<unary*>(b.get())) {
+        b = expr->release_operand();
+    }
+}
+
+} // namespace takatori::scalar
@@ -1,7 +1,12 @@
 #include <takatori/scalar/walk.h>
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include <takatori/util/downcast.h>
+
 #include "test_utils.h"
 
 namespace takatori::scalar {
@@ -426,4 +431,76 @@ TEST_F(expression_walk_test, pre_void) {
     check(c.a);
 }
 
+TEST_F(expression_walk_test, order) {
+    struct cb {
+        std::vector<int> pre {};
+        std::vector<int> post {};
+        bool operator()(expression const&) { return true; }
+        void operator()(post_visit, expression const&) {}
+        bool operator()(immediate const& expr) {
+            pre.emplace_back(value_of<value::int4>(expr));
+            return true;
+        }
+        void operator()(post_visit, immediate const& expr) {
+            post.emplace_back(value_of<value::int4>(expr));
+        }
+    };
+    cb c;
+    coalesce expr {
+            {
+                    binary {
+                            binary_operator::add,
+                            constant(1),
+                            constant(2),
+                    },
+                    constant(3),
+                    binary {
+                            binary_operator::add,
+                            constant(4),
+                            constant(5),
+                    },
+            },
+    };
+    walk(c, std::as_const(expr));
+    EXPECT_EQ(c.pre, (std::vector<int> { 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(c.post, (std::vector<int> { 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(expression_walk_test, deep) {
+    constexpr std::size_t depth = 100'000;
+    std::unique_ptr<expression> root = std::make_unique<immediate>(value::int4(0), type::int4());
+    for (std::size_t i = 1; i < depth; ++i) {
+        root = std::make_unique<binary>(
+                binary_operator::add,
+                std::move(root),
+                std::make_unique<immediate>(value::int4(static_cast<int>(i)), type::int4()));
+    }
+
+    struct cb {
+        std::size_t binaries {};
+        std::size_t immediates {};
+        std::size_t posts {};
+        void operator()(expression const&) {}
+        void operator()(binary const&) {
+            ++binaries;
+        }
+        void operator()(immediate const&) {
+            ++immediates;
+        }
+        void operator()(post_visit, expression const&) {
+            ++posts;
+        }
+    };
+    cb c;
+    walk(c, std::as_const(*root));
+    EXPECT_EQ(c.binaries, depth - 1);
+    EXPECT_EQ(c.immediates, depth);
+    EXPECT_EQ(c.posts, depth * 2 - 1);
+
+    // dismantle the expression without deep recursion
+    while (root->kind() == binary::tag) {
+        root = util::downcast<binary>(*root).release_left();
+    }
+}
+
 } // namespace takatori::scalar
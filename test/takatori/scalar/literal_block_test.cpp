@@ -0,0 +1,232 @@
+#include <takatori/scalar/literal_block.h>
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "test_utils.h"
+
+#include <takatori/type/primitive.h>
+#include <takatori/type/character.h>
+#include <takatori/type/decimal.h>
+#include <takatori/value/primitive.h>
+#include <takatori/value/character.h>
+#include <takatori/value/decimal.h>
+
+namespace takatori::scalar {
+
+class literal_block_test : public ::testing::Test {};
+
+namespace {
+
+class broken_value : public value::data {
+public:
+    [[nodiscard]] value::value_kind kind() const noexcept override {
+        return value::value_kind::extension;
+    }
+
+    [[nodiscard]] broken_value* clone() const& override {
+        throw std::runtime_error("broken");
+    }
+
+    [[nodiscard]] broken_value* clone() && override {
+        throw std::runtime_error("broken");
+    }
+
+protected:
+    [[nodiscard]] bool equals(data const&) const noexcept override {
+        return false;
+    }
+
+    [[nodiscard]] std::size_t hash() const noexcept override {
+        return 0;
+    }
+
+    std::ostream& print_to(std::ostream& out) const override {
+        return out << "broken";
+    }
+};
+
+} // namespace
+
+TEST_F(literal_block_test, simple) {
+    literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::character>(type::varying),
+    }};
+    block.add_row(value::int4(1), value::character("a"));
+    block.add_row(value::int4(2), value::character("bc"));
+    block.add_row(value::int4(3), value::character(""));
+
+    ASSERT_EQ(block.columns().size(), 2);
+    ASSERT_EQ(block.row_count(), 3);
+
+    auto&& c0 = block.columns()[0];
+    EXPECT_EQ(c0.type(), type::int4());
+    EXPECT_EQ(c0.packed_kind(), value::value_kind::int4);
+    EXPECT_EQ(c0.get<value::value_kind::int4>(0), 1);
+    EXPECT_EQ(c0.get<value::value_kind::int4>(1), 2);
+    EXPECT_EQ(c0.get<value::value_kind::int4>(2), 3);
+
+    auto&& c1 = block.columns()[1];
+    EXPECT_EQ(c1.packed_kind(), value::value_kind::character);
+    EXPECT_EQ(c1.get<value::value_kind::character>(0), "a");
+    EXPECT_EQ(c1.get<value::value_kind::character>(1), "bc");
+    EXPECT_EQ(c1.get<value::value_kind::character>(2), "");
+
+    EXPECT_EQ(*c1.value(1), value::character("bc"));
+    EXPECT_THROW((void) c0.get<value::value_kind::int8>(0), std::invalid_argument);
+    EXPECT_THROW((void) c0.value(3), std::out_of_range);
+}
+
+TEST_F(literal_block_test, null) {
+    literal_block block {{
+            std::make_shared<type::int8>(),
+    }};
+    block.add_row(value::unknown());
+    block.add_row(value::int8(100));
+    block.add_row(value::unknown());
+
+    auto&& c0 = block.columns()[0];
+    ASSERT_EQ(c0.size(), 3);
+    EXPECT_TRUE(c0.is_null(0));
+    EXPECT_FALSE(c0.is_null(1));
+    EXPECT_TRUE(c0.is_null(2));
+    EXPECT_EQ(c0.kind(0), value::value_kind::unknown);
+    EXPECT_EQ(c0.kind(1), value::value_kind::int8);
+    EXPECT_EQ(c0.get<value::value_kind::int8>(1), 100);
+    EXPECT_EQ(*c0.value(0), value::unknown());
+}
+
+TEST_F(literal_block_test, mixed_kinds) {
+    literal_block block {{
+            std::make_shared<type::decimal>(),
+    }};
+    block.add_row(value::decimal(decimal::triple { 1, 0, 12345, -2 }));
+    block.add_row(value::int4(10));
+    block.add_row(value::decimal(decimal::triple { -1, 0, 1, 0 }));
+
+    auto&& c0 = block.columns()[0];
+    EXPECT_EQ(c0.packed_kind(), value::value_kind::decimal);
+    EXPECT_EQ(c0.get<value::value_kind::decimal>(0), (decimal::triple { 1, 0, 12345, -2 }));
+    EXPECT_EQ(c0.kind(1), value::value_kind::int4);
+    EXPECT_EQ(c0.get<value::value_kind::int4>(1), 10);
+    EXPECT_EQ(c0.get<value::value_kind::decimal>(2), (decimal::triple { -1, 0, 1, 0 }));
+}
+
+TEST_F(literal_block_test, add_row_inconsistent) {
+    literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::int4>(),
+    }};
+    EXPECT_THROW(block.add_row(value::int4(1)), std::invalid_argument);
+}
+
+TEST_F(literal_block_test, add_row_rollback) {
+    literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::character>(type::varying),
+            std::make_shared<type::int4>(),
+    }};
+    block.add_row(value::int4(1), value::character("a"), value::int4(2));
+    EXPECT_THROW(block.add_row(value::int4(3), value::character("bc"), broken_value {}), std::runtime_error);
+    value::character d { "d" };
+    broken_value broken {};
+    EXPECT_THROW(block.add_row({ nullptr, &d, &broken }), std::runtime_error);
+
+    for (auto&& column : block.columns()) {
+        EXPECT_EQ(column.size(), 1);
+    }
+    ASSERT_EQ(block.row_count(), 1);
+
+    block.add_row(value::int4(4), value::character("e"), value::int4(5));
+    ASSERT_EQ(block.row_count(), 2);
+    auto&& c1 = block.columns()[1];
+    EXPECT_EQ(c1.get<value::value_kind::character>(0), "a");
+    EXPECT_EQ(c1.get<value::value_kind::character>(1), "e");
+    EXPECT_EQ(block.columns()[2].get<value::value_kind::int4>(1), 5);
+
+    literal_block expect {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::character>(type::varying),
+            std::make_shared<type::int4>(),
+    }};
+    expect.add_row(value::int4(1), value::character("a"), value::int4(2));
+    expect.add_row(value::int4(4), value::character("e"), value::int4(5));
+    EXPECT_EQ(block, expect);
+}
+
+TEST_F(literal_block_test, add_row_rollback_packed_kind) {
+    literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::int4>(),
+    }};
+    block.add_row({ nullptr, nullptr });
+    EXPECT_THROW(block.add_row(value::int4(1), broken_value {}), std::runtime_error);
+    EXPECT_FALSE(block.columns()[0].packed_kind());
+
+    block.add_row(value::int8(2), value::int4(3));
+    EXPECT_EQ(block.columns()[0].packed_kind(), value::value_kind::int8);
+}
+
+TEST_F(literal_block_test, materialize) {
+    auto type = std::make_shared<type::int4>();
+    literal_block block {{ type }};
+    block.add_row(value::int4(1));
+
+    auto expr = block.materialize(0, 0);
+    EXPECT_EQ(*expr, constant(1));
+    EXPECT_EQ(expr->shared_type(), type);
+}
+
+TEST_F(literal_block_test, equals) {
+    literal_block a {{ std::make_shared<type::int4>() }};
+    a.add_row(value::int4(1));
+    a.add_row(value::unknown());
+
+    literal_block b {{ std::make_shared<type::int4>() }};
+    b.add_row(value::int4(1));
+    b.add_row(value::unknown());
+    EXPECT_EQ(a, b);
+
+    b.add_row(value::int4(2));
+    EXPECT_NE(a, b);
+}
+
+TEST_F(literal_block_test, equals_mixed_kinds) {
+    literal_block a {{ std::make_shared<type::decimal>() }};
+    a.add_row(value::decimal(decimal::triple { 1, 0, 12345, -2 }));
+    a.add_row(value::character("a"));
+    a.add_row(value::unknown());
+
+    literal_block b {{ std::make_shared<type::decimal>() }};
+    b.add_row(value::decimal(decimal::triple { 1, 0, 12345, -2 }));
+    b.add_row(value::character("a"));
+    b.add_row(value::unknown());
+    EXPECT_EQ(a, b);
+
+    literal_block c {{ std::make_shared<type::decimal>() }};
+    c.add_row(value::character("a"));
+    c.add_row(value::decimal(decimal::triple { 1, 0, 12345, -2 }));
+    c.add_row(value::unknown());
+    EXPECT_NE(a, c);
+
+    literal_block d {{ std::make_shared<type::decimal>() }};
+    d.add_row(value::decimal(decimal::triple { 1, 0, 12345, -2 }));
+    d.add_row(value::character("b"));
+    d.add_row(value::unknown());
+    EXPECT_NE(a, d);
+}
+
+TEST_F(literal_block_test, output) {
+    literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::character>(type::varying),
+    }};
+    block.add_row(value::int4(1), value::character("a"));
+    block.add_row(value::unknown(), value::character("b"));
+
+    std::cout << block << std::endl;
+}
+
+} // namespace takatori::scalar
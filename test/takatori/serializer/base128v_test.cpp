@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
 #include <limits>
+#include <random>
+#include <vector>
 
 namespace takatori::serializer::base128v {
 
@@ -301,4 +305,178 @@ TEST_F(base128v_test, read_undeflow) {
     }
 }
 
+TEST_F(base128v_test, read_unsigned_padded) {
+    std::vector<std::uint64_t> values { 0, 1 };
+    for (std::uint64_t i = 1; i <= 9; ++i) {
+        values.emplace_back((1ULL << std::min(i * 7U, 63UL)) - 1);
+        values.emplace_back(1ULL << std::min(i * 7U, 63UL));
+    }
+    values.emplace_back(std::numeric_limits<std::uint64_t>::max());
+    for (auto value : values) {
+        auto buf = dump_unsigned(value);
+        auto size = buf.size();
+        buf.append(16, '\xff');
+        util::buffer_view view { buf.data(), buf.size() };
+        auto iter = view.begin();
+        auto result = read_unsigned(iter, view.end());
+        ASSERT_TRUE(result) << value;
+        EXPECT_EQ(*result, value);
+        EXPECT_EQ(std::distance(view.begin(), iter), size);
+    }
+}
+
+TEST_F(base128v_test, read_unsigned_strict) {
+    auto padding = std::string(16, '\x00');
+    {
+        auto buf = str({ 0x80, 0x00 }) + padding;
+        util::buffer_view view { buf.data(), buf.size() };
+        auto iter = view.begin();
+        EXPECT_FALSE(read_unsigned(iter, view.end()));
+        EXPECT_EQ(iter, view.begin());
+    }
+    {
+        auto buf = str({ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 }) + padding;
+        util::buffer_view view { buf.data(), buf.size() };
+        auto iter = view.begin();
+        EXPECT_FALSE(read_unsigned(iter, view.end()));
+        EXPECT_EQ(iter, view.begin());
+    }
+    {
+        auto buf = str({ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 });
+        util::buffer_view view { buf.data(), buf.size() };
+        auto iter = view.begin();
+        EXPECT_FALSE(read_unsigned(iter, view.end()));
+        EXPECT_EQ(iter, view.begin());
+    }
+}
+
+TEST_F(base128v_test, read_write_signed_values) {
+    std::vector<std::int64_t> values {
+            0,
+            -1,
+            +1,
+            1'000,
+            -100'000,
+            std::numeric_limits<std::int64_t>::max(),
+            std::numeric_limits<std::int64_t>::min(),
+    };
+    std::string buf {};
+    buf.resize(values.size() * 9);
+    util::buffer_view view { buf.data(), buf.size() };
+    auto out = view.begin();
+    ASSERT_EQ(write_signed_values(values, out, view.end()), values.size());
+
+    std::vector<std::int64_t> results(values.size() + 1);
+    util::buffer_view::const_iterator in = view.begin();
+    ASSERT_EQ(read_signed_values(in, out, results), values.size());
+    EXPECT_EQ(in, out);
+    results.resize(values.size());
+    EXPECT_EQ(results, values);
+}
+
+TEST_F(base128v_test, write_unsigned_keeps_rest) {
+    for (std::uint64_t i = 0; i < 9; ++i) {
+        std::uint64_t value = 1ULL << (i * 7U);
+        std::string buf(16, '\xcc');
+        util::buffer_view view { buf.data(), buf.size() };
+        auto iter = view.begin();
+        ASSERT_TRUE(write_unsigned(value, iter, view.end()));
+        auto size = static_cast<std::size_t>(std::distance(view.begin(), iter));
+        ASSERT_EQ(size, i + 1);
+        EXPECT_EQ(buf.substr(0, size), dump_unsigned(value));
+        EXPECT_EQ(buf.substr(size), std::string(16 - size, '\xcc')) << value;
+    }
+}
+
+TEST_F(base128v_test, write_unsigned_values_overflow) {
+    std::vector<std::uint64_t> values { 1, 1'000, 1 };
+    std::string buf {};
+    buf.resize(2);
+    util::buffer_view view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(write_unsigned_values(values, iter, view.end()), 1);
+    EXPECT_EQ(std::distance(view.begin(), iter), 1);
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST_F(base128v_test, DISABLED_benchmark) {
+    static constexpr std::size_t count = 1'000'000;
+    static constexpr std::size_t rounds = 20;
+
+    // the former byte-wise implementation, as the baseline
+    auto baseline_write = [](std::uint64_t value, util::buffer_view::iterator& iter) {
+        for (std::uint64_t i = 0; i < 8; ++i) {
+            auto group = value & 0x7fULL;
+            value >>= 7ULL;
+            if (value == 0) {
+                *iter++ = static_cast<char>(group);
+                return;
+            }
+            *iter++ = static_cast<char>(0x80ULL | group);
+        }
+        *iter++ = static_cast<char>(value);
+    };
+    auto baseline = [](util::buffer_view::const_iterator& iter, util::buffer_view::const_iterator end) {
+        std::uint64_t result {};
+        for (std::uint64_t i = 0; i < 8; ++i) {
+            if (iter == end) {
+                return result;
+            }
+            auto group = static_cast<std::uint64_t>(static_cast<unsigned char>(*iter++));
+            result |= (group & 0x7fULL) << (i * 7);
+            if ((group & 0x80ULL) == 0) {
+                return result;
+            }
+        }
+        return result | static_cast<std::uint64_t>(static_cast<unsigned char>(*iter++)) << 56ULL;
+    };
+
+    std::mt19937_64 random { 12345 };
+    std::vector<std::uint64_t> values(count);
+    for (auto& value : values) {
+        value = random() >> (random() % 64);
+    }
+    std::string buf {};
+    buf.resize(count * 9);
+    util::buffer_view view { buf.data(), buf.size() };
+    auto out = view.begin();
+    ASSERT_EQ(write_unsigned_values(values, out, view.end()), count);
+
+    std::vector<std::uint64_t> results(count);
+    auto measure = [&](auto&& action) {
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < rounds; ++i) {
+            action();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    };
+    auto base = measure([&] {
+        util::buffer_view::const_iterator iter = view.begin();
+        for (auto& result : results) {
+            result = baseline(iter, out);
+        }
+    });
+    EXPECT_EQ(results, values);
+    auto bulk = measure([&] {
+        util::buffer_view::const_iterator iter = view.begin();
+        read_unsigned_values(iter, out, results);
+    });
+    EXPECT_EQ(results, values);
+    auto encode_base = measure([&] {
+        auto iter = view.begin();
+        for (auto value : values) {
+            baseline_write(value, iter);
+        }
+    });
+    auto encode = measure([&] {
+        auto iter = view.begin();
+        write_unsigned_values(values, iter, view.end());
+    });
+    std::cout << "decode (baseline): " << base << "us" << std::endl;
+    std::cout << "decode (bulk): " << bulk << "us" << std::endl;
+    std::cout << "encode (baseline): " << encode_base << "us" << std::endl;
+    std::cout << "encode (bulk): " << encode << "us" << std::endl;
+}
+
 } // namespace takatori::serializer::base128v
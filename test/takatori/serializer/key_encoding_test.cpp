@@ -0,0 +1,322 @@
+#include <takatori/serializer/key_encoding.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <takatori/serializer/value_input_exception.h>
+
+#include <takatori/value/primitive.h>
+#include <takatori/value/character.h>
+#include <takatori/value/unknown.h>
+
+namespace takatori::serializer {
+
+using buffer = util::buffer_view;
+
+using relation::sort_direction;
+
+class key_encoding_test : public ::testing::Test {
+public:
+    template<class T, class Writer>
+    static std::vector<std::string> encode_all(
+            std::vector<T> const& values,
+            Writer&& writer,
+            sort_direction direction = sort_direction::ascendant) {
+        std::vector<std::string> results {};
+        results.reserve(values.size());
+        for (auto&& value : values) {
+            std::string key {};
+            writer(value, key, direction, null_order::first);
+            results.emplace_back(std::move(key));
+        }
+        return results;
+    }
+
+    // checks the keys are strictly ordered in the given direction
+    static void check_ordered(std::vector<std::string> const& keys, sort_direction direction) {
+        for (std::size_t i = 1; i < keys.size(); ++i) {
+            if (direction == sort_direction::ascendant) {
+                EXPECT_LT(keys[i - 1], keys[i]) << i;
+            } else {
+                EXPECT_GT(keys[i - 1], keys[i]) << i;
+            }
+        }
+    }
+
+    template<class T, class Writer>
+    static void check_ordered(std::vector<T> const& values, Writer&& writer) {
+        check_ordered(encode_all(values, writer, sort_direction::ascendant), sort_direction::ascendant);
+        check_ordered(encode_all(values, writer, sort_direction::descendant), sort_direction::descendant);
+    }
+
+    template<class Reader>
+    static auto decode(std::string const& key, Reader&& reader, sort_direction direction = sort_direction::ascendant) {
+        buffer::const_iterator iter = key.data();
+        buffer::const_iterator end = key.data() + key.size(); // NOLINT
+        auto result = reader(iter, end, direction, null_order::first);
+        EXPECT_EQ(iter, end);
+        return result;
+    }
+};
+
+TEST_F(key_encoding_test, int4) {
+    std::vector<std::int32_t> values {
+            std::numeric_limits<std::int32_t>::min(),
+            -100,
+            -1,
+            0,
+            1,
+            100,
+            std::numeric_limits<std::int32_t>::max(),
+    };
+    check_ordered(values, write_key_int4);
+    for (auto direction : { sort_direction::ascendant, sort_direction::descendant }) {
+        for (auto v : values) {
+            std::string key {};
+            write_key_int4(v, key, direction);
+            EXPECT_EQ(decode(key, read_key_int4, direction), v);
+        }
+    }
+}
+
+TEST_F(key_encoding_test, int8) {
+    std::vector<std::int64_t> values {
+            std::numeric_limits<std::int64_t>::min(),
+            -(1LL << 40),
+            -1,
+            0,
+            1,
+            1LL << 40,
+            std::numeric_limits<std::int64_t>::max(),
+    };
+    check_ordered(values, write_key_int8);
+    for (auto v : values) {
+        std::string key {};
+        write_key_int8(v, key, sort_direction::descendant);
+        EXPECT_EQ(decode(key, read_key_int8, sort_direction::descendant), v);
+    }
+}
+
+TEST_F(key_encoding_test, float8) {
+    std::vector<double> values {
+            -std::numeric_limits<double>::infinity(),
+            -1e100,
+            -1.5,
+            -std::numeric_limits<double>::denorm_min(),
+            0.0,
+            std::numeric_limits<double>::denorm_min(),
+            1.5,
+            1e100,
+            std::numeric_limits<double>::infinity(),
+            std::numeric_limits<double>::quiet_NaN(),
+    };
+    check_ordered(values, write_key_float8);
+    for (auto v : values) {
+        std::string key {};
+        write_key_float8(v, key);
+        auto result = decode(key, read_key_float8);
+        ASSERT_TRUE(result);
+        if (std::isnan(v)) {
+            EXPECT_TRUE(std::isnan(*result));
+        } else {
+            EXPECT_EQ(*result, v);
+        }
+    }
+
+    std::string negative_zero {};
+    std::string positive_zero {};
+    write_key_float8(-0.0, negative_zero);
+    write_key_float8(+0.0, positive_zero);
+    EXPECT_EQ(negative_zero, positive_zero);
+}
+
+TEST_F(key_encoding_test, float4) {
+    std::vector<float> values { -1e10F, -1.0F, 0.0F, 0.5F, 1.0F, 1e10F };
+    check_ordered(values, write_key_float4);
+
+    std::string key {};
+    write_key_float4(-0.5F, key, sort_direction::descendant);
+    EXPECT_EQ(decode(key, read_key_float4, sort_direction::descendant), -0.5F);
+}
+
+TEST_F(key_encoding_test, decimal) {
+    std::vector<decimal::triple> values {
+            decimal::triple { -1, 0, 1, 10 },
+            decimal::triple { -123, 0 },
+            decimal::triple { -12, 0 },
+            decimal::triple { -1, 0 },
+            decimal::triple { -9, -1 },
+            decimal::triple { -1, -30 },
+            decimal::triple {},
+            decimal::triple { 1, -30 },
+            decimal::triple { 1, -1 },
+            decimal::triple { 99, -2 },
+            decimal::triple { 1, 0 },
+            decimal::triple { 101, -2 },
+            decimal::triple { 11, -1 },
+            decimal::triple { 12, 0 },
+            decimal::triple { 123, 0 },
+            decimal::triple { +1, ~0ULL, ~0ULL, 0 },
+            decimal::triple { 1, 100 },
+    };
+    check_ordered(values, write_key_decimal);
+
+    for (auto direction : { sort_direction::ascendant, sort_direction::descendant }) {
+        for (auto v : values) {
+            std::string key {};
+            write_key_decimal(v, key, direction);
+            EXPECT_EQ(decode(key, read_key_decimal, direction), v);
+        }
+    }
+}
+
+TEST_F(key_encoding_test, decimal_normalized) {
+    std::string a {};
+    std::string b {};
+    write_key_decimal(decimal::triple { 10, -1 }, a);
+    write_key_decimal(decimal::triple { 1000, -3 }, b);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(decode(a, read_key_decimal), (decimal::triple { 1, 0 }));
+
+    std::string zero {};
+    write_key_decimal(decimal::triple { 0, 5 }, zero);
+    EXPECT_EQ(decode(zero, read_key_decimal), decimal::triple {});
+}
+
+TEST_F(key_encoding_test, character) {
+    using namespace std::string_literals;
+    std::vector<std::string> values {
+            ""s,
+            "\0"s,
+            "\0\0"s,
+            "\0a"s,
+            "a"s,
+            "a\0"s,
+            "a\0\xff"s,
+            "ab"s,
+            "a\xff"s,
+            "b"s,
+            "\xff"s,
+    };
+    check_ordered(values, write_key_character);
+    for (auto direction : { sort_direction::ascendant, sort_direction::descendant }) {
+        for (auto&& v : values) {
+            std::string key {};
+            write_key_octet(v, key, direction);
+            EXPECT_EQ(decode(key, read_key_octet, direction), v);
+        }
+    }
+}
+
+TEST_F(key_encoding_test, datetime) {
+    check_ordered(std::vector<datetime::date> {
+            datetime::date { -1000 },
+            datetime::date { 0 },
+            datetime::date { 2000, 1, 1 },
+    }, write_key_date);
+    check_ordered(std::vector<datetime::time_of_day> {
+            datetime::time_of_day { 0, 0, 0 },
+            datetime::time_of_day { 0, 0, 0, std::chrono::nanoseconds { 1 } },
+            datetime::time_of_day { 23, 59, 59 },
+    }, write_key_time_of_day);
+    std::vector<datetime::time_point> points {
+            datetime::time_point { datetime::time_point::offset_type { -1 }, std::chrono::nanoseconds { 5 } },
+            datetime::time_point {},
+            datetime::time_point { datetime::time_point::offset_type { 0 }, std::chrono::nanoseconds { 1 } },
+            datetime::time_point { datetime::time_point::offset_type { 1 } },
+    };
+    check_ordered(points, write_key_time_point);
+    for (auto&& v : points) {
+        std::string key {};
+        write_key_time_point(v, key, sort_direction::descendant);
+        EXPECT_EQ(decode(key, read_key_time_point, sort_direction::descendant), v);
+    }
+}
+
+TEST_F(key_encoding_test, nulls) {
+    for (auto direction : { sort_direction::ascendant, sort_direction::descendant }) {
+        std::string null_first {};
+        std::string null_last {};
+        std::string value {};
+        write_key_null(null_first, null_order::first);
+        write_key_null(null_last, null_order::last);
+        write_key_int4(std::numeric_limits<std::int32_t>::min(), value, direction);
+        EXPECT_LT(null_first, value);
+        EXPECT_GT(null_last, value);
+
+        value.clear();
+        write_key_int4(std::numeric_limits<std::int32_t>::max(), value, direction);
+        EXPECT_LT(null_first, value);
+        EXPECT_GT(null_last, value);
+
+        EXPECT_EQ(decode(null_last, [&](auto& iter, auto end, auto, auto) {
+            return read_key_int4(iter, end, direction, null_order::last);
+        }), std::nullopt);
+    }
+}
+
+TEST_F(key_encoding_test, composite) {
+    using namespace std::string_view_literals;
+    // (character ASC, int8 DESC)
+    auto key = [](std::string_view s, std::int64_t v) {
+        std::string result {};
+        write_key_character(s, result);
+        write_key_int8(v, result, sort_direction::descendant);
+        return result;
+    };
+    EXPECT_LT(key("a", 2), key("a", 1));
+    EXPECT_LT(key("a", -100), key("ab", 100));
+    EXPECT_LT(key("", 1), key("\0"sv, 100));
+
+    auto k = key("abc", 42);
+    buffer::const_iterator iter = k.data();
+    buffer::const_iterator end = k.data() + k.size(); // NOLINT
+    EXPECT_EQ(read_key_character(iter, end), "abc");
+    EXPECT_EQ(read_key_int8(iter, end, sort_direction::descendant), 42);
+    EXPECT_EQ(iter, end);
+}
+
+TEST_F(key_encoding_test, generic) {
+    std::vector<std::unique_ptr<value::data>> values {};
+    values.emplace_back(std::make_unique<value::int4>(1));
+    values.emplace_back(std::make_unique<value::unknown>());
+    values.emplace_back(std::make_unique<value::character>("x"));
+
+    std::string key {};
+    for (auto&& v : values) {
+        write_key(*v, key, sort_direction::descendant, null_order::last);
+    }
+
+    buffer::const_iterator iter = key.data();
+    buffer::const_iterator end = key.data() + key.size(); // NOLINT
+    auto kinds = { value::value_kind::int4, value::value_kind::int4, value::value_kind::character };
+    std::size_t index = 0;
+    for (auto kind : kinds) {
+        auto v = read_key(kind, iter, end, sort_direction::descendant, null_order::last);
+        EXPECT_EQ(*v, *values[index]);
+        ++index;
+    }
+    EXPECT_EQ(iter, end);
+}
+
+TEST_F(key_encoding_test, malformed) {
+    std::string key {};
+    write_key_int8(1, key);
+    key.pop_back();
+
+    buffer::const_iterator iter = key.data();
+    buffer::const_iterator end = key.data() + key.size(); // NOLINT
+    EXPECT_THROW((void) read_key_int8(iter, end), value_input_exception);
+    EXPECT_EQ(iter, key.data());
+
+    std::string invalid { "\x05" };
+    iter = invalid.data();
+    end = invalid.data() + invalid.size(); // NOLINT
+    EXPECT_THROW((void) read_key_int8(iter, end), value_input_exception);
+}
+
+} // namespace takatori::serializer
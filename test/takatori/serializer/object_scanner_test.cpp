@@ -1,5 +1,6 @@
 #include <takatori/serializer/object_scanner.h>
 
+#include <sstream>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -613,6 +614,43 @@ TEST_F(object_scanner_test, relation_values) {
     });
 }
 
+TEST_F(object_scanner_test, relation_values_block) {
+    scalar::literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::int4>(),
+    }};
+    block.add_row(value::int4 { 100 }, value::int4 { 100 });
+    block.add_row(value::int4 { 100 }, value::int4 { 100 });
+    relation::values expr {
+            {
+                    vardesc(1),
+                    vardesc(2),
+            },
+            {},
+    };
+    expr.block(std::make_shared<scalar::literal_block>(std::move(block)));
+    print(expr);
+
+    relation::values rows {
+            {
+                    vardesc(1),
+                    vardesc(2),
+            },
+            {
+                    { const_int4(), const_int4(), },
+                    { const_int4(), const_int4(), },
+            },
+    };
+    auto to_json = [&](relation::values const& element) {
+        std::ostringstream out {};
+        json_printer printer { out };
+        object_scanner scanner { verbose };
+        scanner(element, printer);
+        return out.str();
+    };
+    EXPECT_EQ(to_json(expr), to_json(rows));
+}
+
 TEST_F(object_scanner_test, relation_join_relation) {
     using relation::intermediate::join;
     join expr {
@@ -6,6 +6,7 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <takatori/serializer/value_output.h>
 
@@ -545,12 +546,230 @@ TEST_F(value_input_test, read_row_begin_full) {
     }
 }
 
-TEST_F(value_input_test, DISABLED_write_clob) {
-    FAIL() << "yet not implemented";
+TEST_F(value_input_test, read_clob) {
+    {
+        auto buf = dump([](auto& iter, auto end) { return write_clob("", iter, end); });
+        auto result = restore<std::string_view>(buf, [](auto& iter, auto end) { return read_clob(iter, end); });
+        EXPECT_EQ(result, "");
+    }
+    {
+        auto buf = dump([](auto& iter, auto end) { return write_clob(n_character(4096), iter, end); }, 4200);
+        auto result = restore<std::string_view>(buf, [](auto& iter, auto end) { return read_clob(iter, end); });
+        EXPECT_EQ(result, n_character(4096));
+    }
+}
+
+TEST_F(value_input_test, read_blob) {
+    {
+        auto buf = dump([](auto& iter, auto end) { return write_blob("", iter, end); });
+        auto result = restore<std::string_view>(buf, [](auto& iter, auto end) { return read_blob(iter, end); });
+        EXPECT_EQ(result, "");
+    }
+    {
+        auto buf = dump([](auto& iter, auto end) { return write_blob(n_octet(4096), iter, end); }, 4200);
+        auto result = restore<std::string_view>(buf, [](auto& iter, auto end) { return read_blob(iter, end); });
+        EXPECT_EQ(result, n_octet(4096));
+    }
+}
+
+TEST_F(value_input_test, read_ints) {
+    std::vector<std::int64_t> values {
+            0, 63, 64, -1, -16, -17, 1'000,
+            std::numeric_limits<std::int64_t>::max(),
+            std::numeric_limits<std::int64_t>::min(),
+    };
+    auto buf = dump([&](auto& iter, auto end) { return write_ints(values, iter, end) == values.size(); });
+    std::vector<std::int64_t> results(values.size());
+    auto count = restore<std::size_t>(buf, [&](auto& iter, auto end) { return read_ints(iter, end, results); });
+    EXPECT_EQ(count, values.size());
+    EXPECT_EQ(results, values);
+}
+
+TEST_F(value_input_test, read_ints_stop) {
+    auto buf = dump([](auto& iter, auto end) {
+        return write_int(1, iter, end)
+            && write_int(1'000, iter, end)
+            && write_float8(1.5, iter, end)
+            && write_int(2, iter, end)
+            && write_int(3, iter, end);
+    });
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    std::vector<std::int64_t> results(10);
+
+    // stops before the other type
+    EXPECT_EQ(read_ints(iter, view.end(), results), 2);
+    EXPECT_EQ(results[0], 1);
+    EXPECT_EQ(results[1], 1'000);
+    EXPECT_EQ(read_ints(iter, view.end(), results), 0);
+    EXPECT_EQ(read_float8(iter, view.end()), 1.5);
+
+    // stops if the destination is filled
+    EXPECT_EQ(read_ints(iter, view.end(), util::sequence_view { results.data(), 1 }), 1);
+    EXPECT_EQ(results[0], 2);
+
+    // stops at the end of buffer
+    EXPECT_EQ(read_ints(iter, view.end(), results), 1);
+    EXPECT_EQ(results[0], 3);
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_input_test, read_ints_broken) {
+    auto buf = dump([](auto& iter, auto end) { return write_int(1'000, iter, end); });
+    buf.resize(buf.size() - 1);
+    std::vector<std::int64_t> results(1);
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    EXPECT_THROW(read_ints(iter, view.end(), results), value_input_exception);
+    EXPECT_EQ(iter, view.begin());
+}
+
+TEST_F(value_input_test, read_float8s) {
+    std::vector<double> values { 0.0, 1.25, -3.14 };
+    auto buf = dump([&](auto& iter, auto end) {
+        return write_float8s(values, iter, end) == values.size() && write_int(0, iter, end);
+    });
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    std::vector<double> results(10);
+    EXPECT_EQ(read_float8s(iter, view.end(), results), 3);
+    results.resize(3);
+    EXPECT_EQ(results, values);
+    EXPECT_EQ(read_int(iter, view.end()), 0);
+}
+
+TEST_F(value_input_test, read_dates) {
+    std::vector<datetime::date> values {
+            datetime::date { 2000, 1, 1 },
+            datetime::date { 1900, 12, 31 },
+            datetime::date {},
+    };
+    auto buf = dump([&](auto& iter, auto end) { return write_dates(values, iter, end) == values.size(); });
+    std::vector<datetime::date> results(values.size());
+    auto count = restore<std::size_t>(buf, [&](auto& iter, auto end) { return read_dates(iter, end, results); });
+    EXPECT_EQ(count, values.size());
+    EXPECT_EQ(results, values);
+}
+
+TEST_F(value_input_test, try_read_int) {
+    auto buf = dump([](auto& iter, auto end) { return write_int(1'000, iter, end); });
+    auto result = restore<value_input_result<std::int64_t>>(buf, [](auto& iter, auto end) {
+        return try_read_int(iter, end);
+    });
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, 1'000);
+}
+
+TEST_F(value_input_test, try_read_underflow) {
+    auto buf = dump([](auto& iter, auto end) { return write_character(n_character(100), iter, end); });
+    buf.resize(buf.size() - 1);
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    auto result = try_read_character(iter, view.end());
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), value_input_exception::reason_code::buffer_underflow);
+    EXPECT_EQ(iter, view.begin());
+
+    auto empty = try_peek_type(view.end(), view.end());
+    ASSERT_FALSE(empty);
+    EXPECT_EQ(empty.error(), value_input_exception::reason_code::buffer_underflow);
+}
+
+TEST_F(value_input_test, try_read_inconsistent) {
+    auto buf = dump([](auto& iter, auto end) { return write_float8(1.5, iter, end); });
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    auto result = try_read_date(iter, view.end());
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), value_input_exception::reason_code::inconsistent_entry_type);
+    EXPECT_EQ(iter, view.begin());
+
+    auto type = try_peek_type(iter, view.end());
+    ASSERT_TRUE(type);
+    EXPECT_EQ(*type, entry_type::float8);
+    EXPECT_EQ(read_float8(iter, view.end()), 1.5);
+}
+
+TEST_F(value_input_test, try_read_out_of_range) {
+    auto buf = dump([](auto& iter, auto end) {
+        return write_datetime_interval(datetime::datetime_interval {}, iter, end);
+    });
+    // replaces the year field with a value out of 32-bit range
+    auto head = buf.substr(0, 1);
+    auto rest = buf.substr(2);
+    auto year = dump([](auto& iter, auto end) { return write_int(std::int64_t { 1 } << 40U, iter, end); }).substr(1);
+    buf = head + year + rest;
+
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    auto result = try_read_datetime_interval(iter, view.end());
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), value_input_exception::reason_code::value_out_of_range);
+    EXPECT_EQ(iter, view.begin());
+    EXPECT_THROW(read_datetime_interval(iter, view.end()), value_input_exception);
+}
+
+TEST_F(value_input_test, skip_entry) {
+    auto buf = dump([](auto& iter, auto end) {
+        return write_row_begin(3, iter, end)
+            && write_int(1, iter, end)
+            && write_array_begin(2, iter, end)
+                && write_character("a", iter, end)
+                && write_row_begin(2, iter, end)
+                    && write_null(iter, end)
+                    && write_decimal(decimal::triple { 1, 0, 12'345, -2 }, iter, end)
+            && write_float8(1.5, iter, end)
+            && write_int(100, iter, end);
+    });
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    skip_entry(iter, view.end());
+    EXPECT_EQ(read_int(iter, view.end()), 100);
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_input_test, skip_entry_broken) {
+    auto buf = dump([](auto& iter, auto end) {
+        return write_array_begin(2, iter, end)
+            && write_int(1, iter, end);
+    });
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    EXPECT_THROW(skip_entry(iter, view.end()), value_input_exception);
+    EXPECT_EQ(iter, view.begin());
+}
+
+TEST_F(value_input_test, index_elements) {
+    auto buf = dump([](auto& iter, auto end) {
+        return write_row_begin(4, iter, end)
+            && write_int(1, iter, end)
+            && write_array_begin(1, iter, end)
+                && write_octet(n_octet(100), iter, end)
+            && write_null(iter, end)
+            && write_character("Hello", iter, end);
+    });
+    std::vector<std::size_t> offsets {};
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    ASSERT_EQ(index_elements(iter, view.end(), offsets), 4);
+    EXPECT_EQ(iter, view.end());
+    ASSERT_EQ(offsets.size(), 4);
+
+    auto field = view.begin() + offsets[3];
+    EXPECT_EQ(read_character(field, view.end()), "Hello");
+
+    field = view.begin() + offsets[0];
+    EXPECT_EQ(read_int(field, view.end()), 1);
+    EXPECT_EQ(field, view.begin() + offsets[1]);
 }
 
-TEST_F(value_input_test, DISABLED_write_blob) {
-    FAIL() << "yet not implemented";
+TEST_F(value_input_test, index_elements_inconsistent) {
+    auto buf = dump([](auto& iter, auto end) { return write_int(1, iter, end); });
+    std::vector<std::size_t> offsets {};
+    cbuffer view { buf.data(), buf.size() };
+    auto iter = view.begin();
+    EXPECT_THROW(index_elements(iter, view.end(), offsets), std::runtime_error);
+    EXPECT_EQ(iter, view.begin());
 }
 
 } // namespace takatori::serializer
@@ -6,6 +6,7 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <takatori/serializer/base128v.h>
 #include <takatori/serializer/details/value_io_constants.h>
@@ -391,12 +392,106 @@ TEST_F(value_output_test, write_row_begin_full) {
             perform([](auto& iter, auto end) { return write_row_begin(4096, iter, end); }));
 }
 
-TEST_F(value_output_test, DISABLED_write_clob) {
-    FAIL() << "yet not implemented";
+TEST_F(value_output_test, write_clob) {
+    EXPECT_EQ(
+            sequence(header_clob, { uint(0) }),
+            perform([](auto& iter, auto end) { return write_clob("", iter, end); }));
+    EXPECT_EQ(
+            sequence(header_clob, { uint(1), "a" }),
+            perform([](auto& iter, auto end) { return write_clob("a", iter, end); }));
+    EXPECT_EQ(
+            sequence(header_clob, { uint(4096), n_character(4096) }),
+            perform([](auto& iter, auto end) { return write_clob(n_character(4096), iter, end); }, 4200));
+}
+
+TEST_F(value_output_test, write_blob) {
+    EXPECT_EQ(
+            sequence(header_blob, { uint(0) }),
+            perform([](auto& iter, auto end) { return write_blob("", iter, end); }));
+    EXPECT_EQ(
+            sequence(header_blob, { uint(1), "a" }),
+            perform([](auto& iter, auto end) { return write_blob("a", iter, end); }));
+    EXPECT_EQ(
+            sequence(header_blob, { uint(4096), n_octet(4096) }),
+            perform([](auto& iter, auto end) { return write_blob(n_octet(4096), iter, end); }, 4200));
+}
+
+TEST_F(value_output_test, write_header) {
+    EXPECT_EQ(
+            perform([](auto& iter, auto end) { return write_character("a", iter, end); }),
+            perform([](auto& iter, auto end) { return write_character_header(1, iter, end); }) + "a");
+    EXPECT_EQ(
+            perform([](auto& iter, auto end) { return write_character(n_character(65), iter, end); }),
+            perform([](auto& iter, auto end) { return write_character_header(65, iter, end); }) + n_character(65));
+    EXPECT_EQ(
+            perform([](auto& iter, auto end) { return write_octet(n_octet(17), iter, end); }),
+            perform([](auto& iter, auto end) { return write_octet_header(17, iter, end); }) + n_octet(17));
+    EXPECT_EQ(
+            perform([](auto& iter, auto end) { return write_clob(n_character(100), iter, end); }),
+            perform([](auto& iter, auto end) { return write_clob_header(100, iter, end); }) + n_character(100));
+    EXPECT_EQ(
+            perform([](auto& iter, auto end) { return write_blob(n_octet(100), iter, end); }),
+            perform([](auto& iter, auto end) { return write_blob_header(100, iter, end); }) + n_octet(100));
+}
+
+TEST_F(value_output_test, write_ints) {
+    std::vector<std::int64_t> values {
+            0, 63, 64, -1, -16, -17, 1'000,
+            std::numeric_limits<std::int64_t>::max(),
+            std::numeric_limits<std::int64_t>::min(),
+    };
+    std::string expect {};
+    for (auto value : values) {
+        expect += perform([=](auto& iter, auto end) { return write_int(value, iter, end); });
+    }
+    EXPECT_EQ(
+            expect,
+            perform([&](auto& iter, auto end) { return write_ints(values, iter, end) == values.size(); }));
+}
+
+TEST_F(value_output_test, write_ints_short) {
+    std::vector<std::int64_t> values { 1, 2, 100, 3 };
+    std::string results {};
+    results.resize(3);
+    buffer buf { results.data(), results.size() };
+    buffer::iterator iter = buf.begin();
+    EXPECT_EQ(write_ints(values, iter, buf.end()), 2);
+    EXPECT_EQ(iter, buf.begin() + 2);
+    EXPECT_EQ(write_ints(util::sequence_view<std::int64_t const> { values.data() + 3, 1 }, iter, buf.end()), 1);
+    EXPECT_EQ(iter, buf.end());
 }
 
-TEST_F(value_output_test, DISABLED_write_blob) {
-    FAIL() << "yet not implemented";
+TEST_F(value_output_test, write_float8s) {
+    std::vector<double> values { 0.0, 1.25, -3.14 };
+    std::string expect {};
+    for (auto value : values) {
+        expect += sequence(header_float8, { fixed<std::uint64_t>(value) });
+    }
+    EXPECT_EQ(
+            expect,
+            perform([&](auto& iter, auto end) { return write_float8s(values, iter, end) == values.size(); }));
+
+    std::string results {};
+    results.resize(20);
+    buffer buf { results.data(), results.size() };
+    buffer::iterator iter = buf.begin();
+    EXPECT_EQ(write_float8s(values, iter, buf.end()), 2);
+    EXPECT_EQ(iter, buf.begin() + 18);
+}
+
+TEST_F(value_output_test, write_dates) {
+    std::vector<datetime::date> values {
+            datetime::date { 2000, 1, 1 },
+            datetime::date { 1900, 12, 31 },
+            datetime::date {},
+    };
+    std::string expect {};
+    for (auto value : values) {
+        expect += sequence(header_date, { sint(value.days_since_epoch()) });
+    }
+    EXPECT_EQ(
+            expect,
+            perform([&](auto& iter, auto end) { return write_dates(values, iter, end) == values.size(); }));
 }
 
 } // namespace takatori::serializer
@@ -0,0 +1,147 @@
+#include <takatori/serializer/value_reader.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <takatori/serializer/value_writer.h>
+
+namespace takatori::serializer {
+
+class value_reader_test : public ::testing::Test {
+public:
+    struct recorder {
+        std::string contents {};
+
+        void write(char const* data, std::size_t size) {
+            contents.append(data, size);
+        }
+    };
+
+    // provides the contents by chunks of the given size
+    struct chunked_source {
+        std::string contents {};
+        std::size_t chunk_size {};
+        std::size_t position {};
+        std::size_t requests {};
+
+        std::size_t read(char* data, std::size_t size) {
+            ++requests;
+            auto n = std::min({ size, chunk_size, contents.size() - position });
+            contents.copy(data, n, position);
+            position += n;
+            return n;
+        }
+    };
+
+    static std::string n_character(std::size_t n) {
+        std::string results {};
+        results.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            results[i] = static_cast<char>('A' + i % 26);
+        }
+        return results;
+    }
+};
+
+TEST_F(value_reader_test, simple) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_int(100);
+    writer.write_character("Hello");
+
+    chunked_source source { r.contents, 1024 };
+    value_reader<chunked_source, std::size_t> reader { source };
+    EXPECT_FALSE(reader.eof());
+    EXPECT_EQ(reader.peek_type(), entry_type::int_);
+    EXPECT_EQ(reader.read_int(), 100);
+    EXPECT_EQ(reader.read_character(), "Hello");
+    EXPECT_TRUE(reader.eof());
+}
+
+TEST_F(value_reader_test, straddle) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_row_begin(6);
+    writer.write_int(1'000'000'000'000LL);
+    writer.write_float8(1.25);
+    writer.write_decimal(decimal::triple { 314, -2 });
+    writer.write_character(n_character(100));
+    writer.write_null();
+    writer.write_date(datetime::date { 2000, 1, 1 });
+    writer.write_end_of_contents();
+
+    for (std::size_t chunk_size = 1; chunk_size <= 7; ++chunk_size) {
+        chunked_source source { r.contents, chunk_size };
+        value_reader<chunked_source, std::size_t> reader { source, 16 };
+        EXPECT_EQ(reader.read_row_begin(), 6);
+        EXPECT_EQ(reader.read_int(), 1'000'000'000'000LL);
+        EXPECT_EQ(reader.read_float8(), 1.25);
+        EXPECT_EQ(reader.read_decimal(), (decimal::triple { 314, -2 }));
+        EXPECT_EQ(reader.read_character(), n_character(100));
+        reader.read_null();
+        EXPECT_EQ(reader.read_date(), (datetime::date { 2000, 1, 1 }));
+        reader.read_end_of_contents();
+        EXPECT_TRUE(reader.eof());
+    }
+}
+
+TEST_F(value_reader_test, bounded) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    for (std::int64_t i = 0; i < 10'000; ++i) {
+        writer.write_int(i * 1'000);
+    }
+
+    chunked_source source { r.contents, 100 };
+    value_reader<chunked_source, std::size_t> reader { source, 64 };
+    for (std::int64_t i = 0; i < 10'000; ++i) {
+        ASSERT_EQ(reader.read_int(), i * 1'000);
+        ASSERT_LE(reader.buffered_size(), 64);
+    }
+    EXPECT_TRUE(reader.eof());
+    EXPECT_EQ(reader.capacity(), 64);
+}
+
+TEST_F(value_reader_test, large_entry) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    auto large = n_character(1000);
+    writer.write_blob(large);
+    writer.write_int(1);
+
+    chunked_source source { r.contents, 50 };
+    value_reader<chunked_source, std::size_t> reader { source, 32 };
+    EXPECT_EQ(reader.read_blob(), large);
+    EXPECT_EQ(reader.read_int(), 1);
+    EXPECT_TRUE(reader.eof());
+}
+
+TEST_F(value_reader_test, truncated) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_character(n_character(100));
+
+    chunked_source source { r.contents.substr(0, 50), 10 };
+    value_reader<chunked_source, std::size_t> reader { source, 32 };
+    try {
+        (void) reader.read_character();
+        FAIL();
+    } catch (value_input_exception const& e) {
+        EXPECT_EQ(e.reason(), value_input_exception::reason_code::buffer_underflow);
+    }
+}
+
+TEST_F(value_reader_test, inconsistent_type) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_int(1);
+
+    chunked_source source { r.contents, 10 };
+    value_reader<chunked_source, std::size_t> reader { source };
+    EXPECT_THROW((void) reader.read_character(), std::runtime_error);
+    EXPECT_EQ(reader.read_int(), 1);
+}
+
+} // namespace takatori::serializer
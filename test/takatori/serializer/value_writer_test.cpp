@@ -0,0 +1,154 @@
+#include <takatori/serializer/value_writer.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <takatori/serializer/buffered_writer.h>
+#include <takatori/serializer/value_input.h>
+
+namespace takatori::serializer {
+
+class value_writer_test : public ::testing::Test {
+public:
+    struct recorder {
+        std::vector<std::pair<char const*, std::size_t>> requests {};
+        std::string contents {};
+
+        void write(char const* data, std::size_t size) {
+            requests.emplace_back(data, size);
+            contents.append(data, size);
+        }
+    };
+
+    static std::string n_character(std::size_t n) {
+        std::string results {};
+        results.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            results[i] = static_cast<char>('A' + i % 26);
+        }
+        return results;
+    }
+};
+
+TEST_F(value_writer_test, simple) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_int(100);
+    writer.write_character("Hello");
+
+    ASSERT_EQ(r.requests.size(), 2);
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_int(iter, view.end()), 100);
+    EXPECT_EQ(read_character(iter, view.end()), "Hello");
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, character_direct) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    auto value = n_character(4096);
+    writer.write_character(value);
+
+    ASSERT_EQ(r.requests.size(), 2);
+    EXPECT_EQ(r.requests[1].first, value.data());
+    EXPECT_EQ(r.requests[1].second, value.size());
+
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_character(iter, view.end()), value);
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, octet_direct) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    auto value = n_character(4096);
+    writer.write_octet(value);
+
+    ASSERT_EQ(r.requests.size(), 2);
+    EXPECT_EQ(r.requests[1].first, value.data());
+
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_octet(iter, view.end()), value);
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, clob) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_clob("Hello");
+    writer.write_clob("");
+
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_clob(iter, view.end()), "Hello");
+    EXPECT_EQ(read_clob(iter, view.end()), "");
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, blob_stream) {
+    recorder r {};
+    value_writer<recorder, std::size_t> writer { r };
+    writer.write_blob_header(10);
+    writer.write_contents("01234");
+    writer.write_contents("56789");
+    writer.write_int(1);
+
+    EXPECT_EQ(r.requests.size(), 4);
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_blob(iter, view.end()), "0123456789");
+    EXPECT_EQ(read_int(iter, view.end()), 1);
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, buffered) {
+    recorder r {};
+    buffered_writer<recorder, std::size_t> buffered { r, 64 };
+    value_writer<buffered_writer<recorder, std::size_t>, std::size_t> writer { buffered };
+    for (std::int64_t i = 0; i < 10; ++i) {
+        writer.write_int(i);
+    }
+    EXPECT_EQ(r.requests.size(), 0);
+    EXPECT_EQ(buffered.buffered_size(), 10);
+
+    buffered.flush();
+    EXPECT_EQ(r.requests.size(), 1);
+    EXPECT_EQ(buffered.buffered_size(), 0);
+
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    for (std::int64_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(read_int(iter, view.end()), i);
+    }
+    EXPECT_EQ(iter, view.end());
+}
+
+TEST_F(value_writer_test, buffered_overflow) {
+    recorder r {};
+    buffered_writer<recorder, std::size_t> buffered { r, 64 };
+    value_writer<buffered_writer<recorder, std::size_t>, std::size_t> writer { buffered };
+    auto large = n_character(4096);
+
+    writer.write_int(1);
+    writer.write_character(large);
+    writer.write_int(2);
+    buffered.flush();
+
+    // [int, header], [contents], [int]
+    ASSERT_EQ(r.requests.size(), 3);
+    EXPECT_EQ(r.requests[1].first, large.data());
+
+    util::const_buffer_view view { r.contents.data(), r.contents.size() };
+    auto iter = view.begin();
+    EXPECT_EQ(read_int(iter, view.end()), 1);
+    EXPECT_EQ(read_character(iter, view.end()), large);
+    EXPECT_EQ(read_int(iter, view.end()), 2);
+    EXPECT_EQ(iter, view.end());
+}
+
+} // namespace takatori::serializer
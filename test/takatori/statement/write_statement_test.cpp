@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 
 #include <takatori/plan/forward.h>
+#include <takatori/type/primitive.h>
+#include <takatori/value/primitive.h>
 #include <takatori/util/clonable.h>
 
 #include "test_utils.h"
@@ -194,4 +196,52 @@ TEST_F(write_statement_test, output) {
     std::cout << stmt << std::endl;
 }
 
+TEST_F(write_statement_test, block) {
+    scalar::literal_block block {{
+            std::make_shared<type::int4>(),
+            std::make_shared<type::int4>(),
+    }};
+    block.add_row(value::int4(0), value::int4(1));
+
+    write stmt {
+            write_kind::insert,
+            tabledesc("T0"),
+            {
+                    columndesc("C0"),
+                    columndesc("C1"),
+            },
+            {},
+    };
+    EXPECT_THROW(
+            stmt.block(std::make_shared<scalar::literal_block>(std::vector<std::shared_ptr<type::data const>> {
+                    std::make_shared<type::int4>(),
+            })),
+            std::invalid_argument);
+    EXPECT_FALSE(stmt.block());
+
+    stmt.block(std::make_shared<scalar::literal_block>(std::move(block)));
+    EXPECT_EQ(stmt.tuples().size(), 0);
+    ASSERT_TRUE(stmt.block());
+
+    auto copy = util::clone_unique(stmt);
+    EXPECT_EQ(stmt, *copy);
+
+    stmt.materialize_block();
+    EXPECT_FALSE(stmt.block());
+    EXPECT_EQ(stmt, (write {
+            write_kind::insert,
+            tabledesc("T0"),
+            {
+                    columndesc("C0"),
+                    columndesc("C1"),
+            },
+            {
+                    {
+                            constant(0),
+                            constant(1),
+                    },
+            },
+    }));
+}
+
 } // namespace takatori::statement
@@ -0,0 +1,91 @@
+#include <takatori/type/repository.h>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <takatori/type/primitive.h>
+#include <takatori/type/decimal.h>
+#include <takatori/type/character.h>
+
+namespace takatori::type {
+
+class type_repository_test : public ::testing::Test {};
+
+TEST_F(type_repository_test, simple) {
+    repository repo {};
+    auto a = repo.get(int4 {});
+    auto b = repo.get(int4 {});
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(*a, int4 {});
+    EXPECT_EQ(repo.size(), 1);
+}
+
+TEST_F(type_repository_test, different) {
+    repository repo {};
+    auto a = repo.get(int4 {});
+    auto b = repo.get(int8 {});
+    auto c = repo.get(decimal { 10, 2 });
+    auto d = repo.get(decimal { 10, 3 });
+    EXPECT_NE(static_cast<data const*>(a.get()), static_cast<data const*>(b.get()));
+    EXPECT_NE(c, d);
+    EXPECT_EQ(*c, decimal(10, 2));
+    EXPECT_EQ(*d, decimal(10, 3));
+    EXPECT_EQ(repo.size(), 4);
+}
+
+TEST_F(type_repository_test, lvalue) {
+    repository repo {};
+    character t { varying, 10 };
+    auto a = repo.get(t);
+    auto b = repo.get(static_cast<data const&>(t));
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a.get(), std::addressof(t));
+    EXPECT_EQ(a->length(), 10);
+}
+
+TEST_F(type_repository_test, shared) {
+    repository repo {};
+    std::shared_ptr<data const> t = std::make_shared<int4>();
+    auto a = repo.get(t);
+    EXPECT_EQ(a, t);
+
+    auto b = repo.get(std::make_shared<int4>());
+    EXPECT_EQ(b, t);
+
+    EXPECT_FALSE(repo.get(std::shared_ptr<data const> {}));
+}
+
+TEST_F(type_repository_test, clear) {
+    repository repo {};
+    auto a = repo.get(int4 {});
+    repo.clear();
+    EXPECT_EQ(repo.size(), 0);
+
+    auto b = repo.get(int4 {});
+    EXPECT_NE(a, b);
+    EXPECT_EQ(*a, *b);
+}
+
+TEST_F(type_repository_test, concurrent) {
+    repository repo {};
+    std::vector<std::shared_ptr<data const>> results(8);
+    std::vector<std::thread> threads {};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i] {
+            for (std::size_t j = 0; j < 100; ++j) {
+                results[i] = repo.get(decimal { 10, static_cast<decimal::size_type>(j % 5) });
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(repo.size(), 5);
+    for (auto&& result : results) {
+        EXPECT_EQ(result, results[0]);
+    }
+}
+
+} // namespace takatori::type
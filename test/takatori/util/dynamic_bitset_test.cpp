@@ -0,0 +1,116 @@
+#include <takatori/util/dynamic_bitset.h>
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include <takatori/util/bitset_view.h>
+
+namespace takatori::util {
+
+class dynamic_bitset_test : public ::testing::Test {};
+
+TEST_F(dynamic_bitset_test, simple) {
+    dynamic_bitset bits { 10 };
+
+    EXPECT_EQ(bits.size(), 10);
+    EXPECT_EQ(bits.count(), 0);
+    EXPECT_TRUE(bits.none());
+
+    bits.set(3);
+    EXPECT_TRUE(bits.get(3));
+    EXPECT_FALSE(bits.get(4));
+    EXPECT_EQ(bits.count(), 1);
+
+    bits.reset(3);
+    EXPECT_FALSE(bits.get(3));
+}
+
+TEST_F(dynamic_bitset_test, grow) {
+    dynamic_bitset bits {};
+    EXPECT_TRUE(bits.empty());
+
+    bits.set(200);
+    EXPECT_EQ(bits.size(), 201);
+    EXPECT_TRUE(bits[200]);
+    EXPECT_FALSE(bits[1000]);
+
+    bits.reset(1000);
+    EXPECT_EQ(bits.size(), 201);
+
+    bits.resize(100);
+    EXPECT_EQ(bits.count(), 0);
+    bits.resize(300);
+    EXPECT_FALSE(bits[200]);
+}
+
+TEST_F(dynamic_bitset_test, find) {
+    dynamic_bitset bits {};
+    bits.set(1).set(64).set(65).set(1000);
+
+    std::vector<std::size_t> found {};
+    for (auto i = bits.find_first(); i != dynamic_bitset::npos; i = bits.find_next(i)) {
+        found.emplace_back(i);
+    }
+    EXPECT_EQ(found, (std::vector<std::size_t> { 1, 64, 65, 1000 }));
+    EXPECT_EQ(dynamic_bitset {}.find_first(), dynamic_bitset::npos);
+}
+
+TEST_F(dynamic_bitset_test, set_operations) {
+    dynamic_bitset a {};
+    a.set(1).set(100);
+    dynamic_bitset b {};
+    b.set(100).set(500);
+
+    auto u = a | b;
+    EXPECT_EQ(u.size(), 501);
+    EXPECT_EQ(u.count(), 3);
+
+    auto i = a & b;
+    EXPECT_EQ(i, dynamic_bitset {}.set(100));
+
+    auto d = a - b;
+    EXPECT_EQ(d, dynamic_bitset {}.set(1));
+
+    auto x = a ^ b;
+    EXPECT_EQ(x, dynamic_bitset {}.set(1).set(500));
+
+    EXPECT_TRUE(a.intersects(b));
+    EXPECT_FALSE(d.intersects(b));
+    EXPECT_TRUE(i.is_subset_of(a));
+    EXPECT_TRUE(i.is_subset_of(b));
+    EXPECT_FALSE(a.is_subset_of(b));
+    EXPECT_TRUE(a.is_subset_of(u));
+    EXPECT_FALSE(u.is_subset_of(a));
+}
+
+TEST_F(dynamic_bitset_test, equivalence) {
+    dynamic_bitset a { 10 };
+    dynamic_bitset b { 1000 };
+    EXPECT_EQ(a, b);
+
+    b.set(999);
+    EXPECT_NE(a, b);
+    EXPECT_NE(b, a);
+}
+
+TEST_F(dynamic_bitset_test, view) {
+    std::array<char, 2> buf { '\x81', '\x02' };
+    dynamic_bitset bits { const_bitset_view { buf.data(), 10 } };
+
+    EXPECT_EQ(bits.size(), 10);
+    EXPECT_EQ(bits.count(), 3);
+    EXPECT_TRUE(bits[0]);
+    EXPECT_TRUE(bits[7]);
+    EXPECT_TRUE(bits[9]);
+
+    EXPECT_EQ(bits.view(), const_bitset_view(buf.data(), 10));
+}
+
+TEST_F(dynamic_bitset_test, output) {
+    dynamic_bitset bits {};
+    bits.set(1).set(3);
+    std::cout << bits << std::endl;
+}
+
+} // namespace takatori::util
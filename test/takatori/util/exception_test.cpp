@@ -2,10 +2,17 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 namespace takatori::util {
 
 class exception_test : public ::testing::Test {
 public:
+    void TearDown() override {
+        set_stacktrace_policy(stacktrace_policy::always);
+        set_stacktrace_sampling_interval(100);
+    }
+
     [[noreturn]] void tt(bool with_trace = true) {
         if (with_trace) {
             throw_exception(std::domain_error("w/ trace"));
@@ -56,4 +63,45 @@ TEST_F(exception_test, print_trace_mssing) {
     }
 }
 
+TEST_F(exception_test, policy_never) {
+    set_stacktrace_policy(stacktrace_policy::never);
+    try {
+        tt();
+        FAIL();
+    } catch (std::domain_error const& e) {
+        EXPECT_EQ(find_trace(e), nullptr);
+    }
+}
+
+TEST_F(exception_test, policy_sampled) {
+    set_stacktrace_policy(stacktrace_policy::sampled);
+    set_stacktrace_sampling_interval(4);
+    std::size_t traced = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        try {
+            tt();
+            FAIL();
+        } catch (std::domain_error const& e) {
+            if (find_trace(e) != nullptr) {
+                ++traced;
+            }
+        }
+    }
+    EXPECT_EQ(traced, 2);
+}
+
+TEST_F(exception_test, policy_raw_addresses) {
+    set_stacktrace_policy(stacktrace_policy::raw_addresses);
+    try {
+        tt();
+        FAIL();
+    } catch (std::domain_error const& e) {
+        auto const* trace = find_trace(e);
+        ASSERT_NE(trace, nullptr);
+        std::ostringstream out {};
+        print_trace(out, e);
+        EXPECT_EQ(out.str().empty(), trace->empty());
+    }
+}
+
 } // namespace takatori::util
@@ -0,0 +1,154 @@
+#include <takatori/util/object_memory.h>
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <takatori/util/clonable.h>
+
+#include <takatori/type/primitive.h>
+#include <takatori/value/primitive.h>
+#include <takatori/scalar/binary.h>
+#include <takatori/scalar/immediate.h>
+#include <takatori/scalar/variable_reference.h>
+
+#include "../testing/descriptors.h"
+
+namespace takatori::util {
+
+class object_memory_test : public ::testing::Test {};
+
+namespace {
+
+class counting_resource : public std::pmr::memory_resource {
+public:
+    std::size_t allocated {};
+    std::size_t deallocated {};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocated;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocated;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]] bool do_is_equal(memory_resource const& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+scalar::binary make_expression() {
+    return scalar::binary {
+            scalar::binary_operator::add,
+            scalar::variable_reference { testing::vardesc(1) },
+            scalar::immediate { value::int4 { 100 }, type::int4 {} },
+    };
+}
+
+} // namespace
+
+TEST_F(object_memory_test, scope) {
+    EXPECT_EQ(object_memory_resource(), nullptr);
+    counting_resource r0 {};
+    counting_resource r1 {};
+    {
+        object_memory_scope s0 { &r0 };
+        EXPECT_EQ(object_memory_resource(), &r0);
+        {
+            object_memory_scope s1 { &r1 };
+            EXPECT_EQ(object_memory_resource(), &r1);
+        }
+        EXPECT_EQ(object_memory_resource(), &r0);
+    }
+    EXPECT_EQ(object_memory_resource(), nullptr);
+}
+
+TEST_F(object_memory_test, default_resource) {
+    auto expr = make_expression();
+    auto copy = clone_unique(expr);
+    EXPECT_EQ(*copy, expr);
+}
+
+#if defined(ENABLE_OBJECT_CREATOR_PMR)
+
+TEST_F(object_memory_test, clone) {
+    auto expr = make_expression();
+    counting_resource resource {};
+    std::unique_ptr<scalar::expression> copy {};
+    {
+        object_memory_scope scope { &resource };
+        copy = clone_unique(expr);
+    }
+    // binary, variable_reference, and immediate (which shares its value and type)
+    EXPECT_EQ(resource.allocated, 3);
+    EXPECT_EQ(resource.deallocated, 0);
+    EXPECT_EQ(*copy, expr);
+
+    // released into the origin resource even if it is out of scope
+    copy.reset();
+    EXPECT_EQ(resource.deallocated, 3);
+}
+
+TEST_F(object_memory_test, clone_shared) {
+    counting_resource resource {};
+    std::shared_ptr<value::data> copy {};
+    {
+        object_memory_scope scope { &resource };
+        copy = clone_shared(value::int4 { 100 });
+    }
+    // the object and its control block
+    EXPECT_EQ(resource.allocated, 2);
+    EXPECT_EQ(*copy, value::int4 { 100 });
+
+    copy.reset();
+    EXPECT_EQ(resource.deallocated, 2);
+}
+
+TEST_F(object_memory_test, make_shared_object) {
+    counting_resource resource {};
+    std::shared_ptr<type::data> object {};
+    {
+        object_memory_scope scope { &resource };
+        object = make_shared_object<type::int4>();
+    }
+    EXPECT_EQ(resource.allocated, 1);
+    EXPECT_EQ(*object, type::int4 {});
+
+    object.reset();
+    EXPECT_EQ(resource.deallocated, 1);
+}
+
+#else // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+TEST_F(object_memory_test, disabled) {
+    auto expr = make_expression();
+    counting_resource resource {};
+    {
+        object_memory_scope scope { &resource };
+        auto copy = clone_unique(expr);
+        auto shared = clone_shared(value::int4 { 100 });
+        auto object = make_shared_object<type::int4>();
+        EXPECT_EQ(*copy, expr);
+    }
+    // never uses the resource
+    EXPECT_EQ(resource.allocated, 0);
+    EXPECT_EQ(sizeof(object_memory_support), 1);
+}
+
+#endif // defined(ENABLE_OBJECT_CREATOR_PMR)
+
+TEST_F(object_memory_test, monotonic) {
+    auto expr = make_expression();
+    std::pmr::monotonic_buffer_resource resource {};
+    object_memory_scope scope { &resource };
+    for (std::size_t i = 0; i < 100; ++i) {
+        auto copy = clone_unique(expr);
+        EXPECT_EQ(*copy, expr);
+    }
+}
+
+} // namespace takatori::util
@@ -258,6 +258,30 @@ TEST_F(static_bitset_test, flip_bitwise) {
     EXPECT_EQ(a, r);
 }
 
+TEST_F(static_bitset_test, multiple_blocks) {
+    static_bitset<130> bits {};
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+
+    EXPECT_EQ(bits.count(), 4);
+    EXPECT_EQ(bits.find_first(), 0);
+    EXPECT_EQ(bits.find_next(0), 63);
+    EXPECT_EQ(bits.find_next(63), 64);
+    EXPECT_EQ(bits.find_next(64), 129);
+    EXPECT_EQ(bits.find_next(129), bits.npos);
+    EXPECT_EQ(bits.find_first(false), 1);
+    EXPECT_EQ(bits.find(128, false), 128);
+    EXPECT_EQ(bits.find(129, false), bits.npos);
+
+    auto flipped = ~bits;
+    EXPECT_EQ(flipped.count(), 126);
+    EXPECT_FALSE(flipped.all());
+    EXPECT_TRUE((flipped | bits).all());
+    EXPECT_EQ(~flipped, bits);
+}
+
 TEST_F(static_bitset_test, output) {
     static_bitset<4> a {0, 1, 0, 1};
     std::cout << a << std::endl;